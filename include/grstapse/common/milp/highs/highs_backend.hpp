@@ -0,0 +1,374 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*!
+ * \brief A HiGHS backed implementation of the subset of the Gurobi C++ interface that is used by the MILP solvers
+ *
+ * The MILP solvers and schedulers are written against the Gurobi C++ interface (GRBModel, GRBVar, GRBLinExpr, ...).
+ * When the project is configured with MILP_BACKEND=HIGHS this header replaces gurobi_c++.h (see milp_backend.hpp) so
+ * the same formulations can be solved with the open source HiGHS solver without a license server.
+ *
+ * Differences from Gurobi:
+ * - Lazy constraints are handled by resolving: after each solve that has an incumbent (optimal or not) the callback
+ *   is run with it and the violated lazy constraints are added to the model before solving again. If no time is left
+ *   to solve again, there is no solution
+ * - Multiple objectives are solved lexicographically (in order of decreasing priority) by constraining each objective
+ *   to its optimal value before moving onto the next
+ * - GRB_IntParam_Threads, GRB_IntParam_PoolSolutions, and GRB_IntParam_SolutionNumber are accepted but ignored (HiGHS
+ *   uses a single process-wide thread pool)
+ *
+ * \file highs_backend.hpp
+ */
+
+// region Constants
+#define GRB_INFINITY 1e100
+#define GRB_UNDEFINED 1e101
+
+#define GRB_CONTINUOUS 'C'
+#define GRB_BINARY 'B'
+#define GRB_INTEGER 'I'
+
+#define GRB_LESS_EQUAL '<'
+#define GRB_GREATER_EQUAL '>'
+#define GRB_EQUAL '='
+
+#define GRB_MINIMIZE 1
+#define GRB_MAXIMIZE -1
+
+#define GRB_LOADED 1
+#define GRB_OPTIMAL 2
+#define GRB_INFEASIBLE 3
+#define GRB_INF_OR_UNBD 4
+#define GRB_UNBOUNDED 5
+#define GRB_TIME_LIMIT 9
+#define GRB_INTERRUPTED 11
+#define GRB_SUBOPTIMAL 13
+
+#define GRB_CB_MIPSOL 4
+#define GRB_CB_MIPNODE 5
+
+enum GRB_DoubleAttr
+{
+    GRB_DoubleAttr_X,
+    GRB_DoubleAttr_LB,
+    GRB_DoubleAttr_UB,
+    GRB_DoubleAttr_Start,
+    GRB_DoubleAttr_RHS,
+    GRB_DoubleAttr_Pi,
+    GRB_DoubleAttr_ObjVal
+};
+enum GRB_IntAttr
+{
+    GRB_IntAttr_ModelSense,
+    GRB_IntAttr_Status,
+    GRB_IntAttr_SolCount,
+    GRB_IntAttr_NumVars,
+    GRB_IntAttr_NumConstrs
+};
+enum GRB_IntParam
+{
+    GRB_IntParam_Threads,
+    GRB_IntParam_Method,
+    GRB_IntParam_LogToConsole,
+    GRB_IntParam_OutputFlag,
+    GRB_IntParam_LazyConstraints,
+    GRB_IntParam_PoolSolutions,
+    GRB_IntParam_SolutionNumber
+};
+enum GRB_DoubleParam
+{
+    GRB_DoubleParam_TimeLimit,
+    GRB_DoubleParam_MIPGap,
+    GRB_DoubleParam_Heuristics
+};
+// endregion
+
+// region Forward Declarations
+class GRBModel;
+class GRBCallback;
+// endregion
+
+namespace grstapse::highs_backend
+{
+    //! Solver parameters shared by GRBEnv and GRBModel
+    struct Parameters
+    {
+        int method            = -1;            //!< -1 automatic, 0/1 simplex, 2 barrier
+        bool log_to_console   = false;         //!< Whether HiGHS prints its output
+        bool lazy_constraints = false;         //!< Whether the callback is allowed to add lazy constraints
+        double time_limit     = GRB_INFINITY;  //!< Total time limit (in seconds) for an optimization
+        double mip_gap        = 1e-4;          //!< Relative MIP gap
+        double heuristics     = 0.05;          //!< Fraction of effort spent on MIP heuristics
+    };
+
+    struct ModelData;
+}  // namespace grstapse::highs_backend
+
+//! \brief Solver environment (a set of default parameters for the models created with it)
+class GRBEnv
+{
+   public:
+    //! Constructor (\p empty is accepted for compatibility, there is nothing to defer)
+    explicit GRBEnv(bool empty = false);
+
+    //! Starts the environment (does nothing)
+    void start();
+
+    void set(GRB_IntParam parameter, int value);
+    void set(GRB_DoubleParam parameter, double value);
+
+    //! \returns The last error message (HiGHS reports errors through exceptions, so this is always empty)
+    [[nodiscard]] std::string getErrorMsg() const;
+
+   private:
+    friend class GRBModel;
+
+    grstapse::highs_backend::Parameters m_parameters;
+};
+
+//! \brief Handle to a variable in a GRBModel
+class GRBVar
+{
+   public:
+    //! Creates an invalid handle
+    GRBVar();
+
+    [[nodiscard]] double get(GRB_DoubleAttr attribute) const;
+    void set(GRB_DoubleAttr attribute, double value);
+
+    //! \returns Whether this handle refers to the same variable as \p other
+    [[nodiscard]] bool sameAs(const GRBVar& other) const;
+
+    //! \returns The column index of the variable in the model
+    [[nodiscard]] inline int index() const;
+
+   private:
+    friend class GRBModel;
+
+    GRBVar(grstapse::highs_backend::ModelData* data, int index);
+
+    grstapse::highs_backend::ModelData* m_data;
+    int m_index;
+};
+
+//! \brief Handle to a linear constraint in a GRBModel
+class GRBConstr
+{
+   public:
+    //! Creates an invalid handle
+    GRBConstr();
+
+    [[nodiscard]] double get(GRB_DoubleAttr attribute) const;
+    void set(GRB_DoubleAttr attribute, double value);
+
+   private:
+    friend class GRBModel;
+
+    GRBConstr(grstapse::highs_backend::ModelData* data, int index);
+
+    grstapse::highs_backend::ModelData* m_data;
+    int m_index;
+};
+
+//! \brief A linear expression of variables and a constant
+class GRBLinExpr
+{
+   public:
+    GRBLinExpr(double constant = 0.0);
+    GRBLinExpr(const GRBVar& var, double coefficient = 1.0);
+
+    //! \returns The constant term of the expression
+    [[nodiscard]] inline double getConstant() const;
+
+    //! \returns The number of (not necessarily unique) variable terms
+    [[nodiscard]] inline unsigned int size() const;
+
+    //! \returns The value of the expression for the current solution
+    [[nodiscard]] double getValue() const;
+
+    GRBLinExpr& operator+=(const GRBLinExpr& rhs);
+    GRBLinExpr& operator-=(const GRBLinExpr& rhs);
+    GRBLinExpr& operator*=(double multiplier);
+
+   private:
+    friend class GRBModel;
+    friend class GRBCallback;
+    friend class GRBTempConstr;
+
+    //! \returns The value of the expression for the column values \p values
+    [[nodiscard]] double evaluate(const std::vector<double>& values) const;
+
+    //! \returns The terms of the expression with duplicate variables combined
+    [[nodiscard]] std::map<int, double> combinedTerms() const;
+
+    std::vector<std::pair<GRBVar, double>> m_terms;
+    double m_constant;
+};
+
+GRBLinExpr operator+(const GRBLinExpr& lhs, const GRBLinExpr& rhs);
+GRBLinExpr operator-(const GRBLinExpr& lhs, const GRBLinExpr& rhs);
+GRBLinExpr operator-(const GRBLinExpr& expr);
+GRBLinExpr operator*(double multiplier, const GRBLinExpr& expr);
+GRBLinExpr operator*(const GRBLinExpr& expr, double multiplier);
+
+//! \brief A constraint that has not yet been added to a model
+class GRBTempConstr
+{
+   public:
+    GRBTempConstr(const GRBLinExpr& lhs, char sense, const GRBLinExpr& rhs);
+
+   private:
+    friend class GRBModel;
+    friend class GRBCallback;
+
+    //! \returns Whether the constraint is violated by the column values \p values
+    [[nodiscard]] bool violated(const std::vector<double>& values, double tolerance) const;
+
+    GRBLinExpr m_expr;  //!< lhs - rhs
+    char m_sense;
+};
+
+GRBTempConstr operator<=(const GRBLinExpr& lhs, const GRBLinExpr& rhs);
+GRBTempConstr operator>=(const GRBLinExpr& lhs, const GRBLinExpr& rhs);
+GRBTempConstr operator==(const GRBLinExpr& lhs, const GRBLinExpr& rhs);
+
+//! \brief Base class for callbacks that are run with each new incumbent solution
+class GRBCallback
+{
+   public:
+    virtual ~GRBCallback() = default;
+
+   protected:
+    GRBCallback();
+
+    virtual void callback() = 0;
+
+    //! \returns The value of \p var in the new incumbent solution
+    [[nodiscard]] double getSolution(const GRBVar& var);
+
+    //! Adds a lazy constraint that cuts off the incumbent solution if it is violated
+    void addLazy(const GRBTempConstr& constraint);
+    //! Adds a lazy constraint that cuts off the incumbent solution if it is violated
+    void addLazy(const GRBLinExpr& expr, char sense, double rhs);
+
+    //! Stops the optimization once the callback returns (the status becomes GRB_INTERRUPTED)
+    void abort();
+
+    int where;
+
+   private:
+    friend class GRBModel;
+
+    //! Runs the callback on \p solution and \returns the lazy constraints that were added
+    [[nodiscard]] std::vector<GRBTempConstr> run(const std::vector<double>& solution);
+
+    const std::vector<double>* m_solution;
+    std::vector<GRBTempConstr> m_lazy_constraints;
+    bool m_aborted;
+};
+
+//! \brief A MILP model solved with HiGHS
+class GRBModel
+{
+   public:
+    explicit GRBModel(const GRBEnv& env);
+    GRBModel(const GRBModel&) = delete;
+    ~GRBModel();
+    GRBModel& operator=(const GRBModel&) = delete;
+
+    GRBVar addVar(double lower_bound, double upper_bound, double objective, char type, const std::string& name = "");
+    GRBConstr addConstr(const GRBTempConstr& constraint, const std::string& name = "");
+
+    //! Sets the (single) objective
+    void setObjective(const GRBLinExpr& expr, int sense = 0);
+
+    /*!
+     * Sets one of multiple objectives
+     *
+     * \note Objectives are optimized lexicographically by \p priority (highest first) and the objectives with the same
+     *       priority are summed together
+     */
+    void setObjectiveN(const GRBLinExpr& expr,
+                       int index,
+                       int priority       = 0,
+                       double weight      = 1.0,
+                       double abs_tol     = 1e-6,
+                       double rel_tol     = 0.0,
+                       const std::string& = "");
+
+    void setCallback(GRBCallback* callback);
+
+    [[nodiscard]] GRBVar getVarByName(const std::string& name) const;
+    [[nodiscard]] GRBConstr getConstrByName(const std::string& name) const;
+
+    [[nodiscard]] int get(GRB_IntAttr attribute) const;
+    [[nodiscard]] double get(GRB_DoubleAttr attribute) const;
+    void set(GRB_IntAttr attribute, int value);
+    void set(GRB_IntParam parameter, int value);
+    void set(GRB_DoubleParam parameter, double value);
+
+    //! Applies pending modifications (modifications are applied immediately, so this does nothing)
+    void update();
+
+    //! Discards the solution
+    void reset();
+
+    //! Solves the model
+    void optimize();
+
+   private:
+    //! Adds \p constraint as a row of the HiGHS model and \returns its index
+    int addRow(const GRBTempConstr& constraint);
+
+    //! Sets the cost of each column (and the objective offset) from \p expr
+    void setCosts(const GRBLinExpr& expr);
+
+    //! Solves the model (resolving with any violated lazy constraints) and updates the status and solution
+    void solve(double time_limit, bool use_start);
+
+    std::unique_ptr<grstapse::highs_backend::ModelData> m_data;
+};
+
+// Inline Functions
+int GRBVar::index() const
+{
+    return m_index;
+}
+
+double GRBLinExpr::getConstant() const
+{
+    return m_constant;
+}
+
+unsigned int GRBLinExpr::size() const
+{
+    return m_terms.size();
+}
\ No newline at end of file
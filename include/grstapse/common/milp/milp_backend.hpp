@@ -0,0 +1,40 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/*!
+ * \brief Selects the MILP solver that backs the Gurobi C++ interface used by the MILP solvers
+ *
+ * Gurobi is used by default. Configuring with MILP_BACKEND=HIGHS defines GRSTAPSE_USE_HIGHS and swaps in the HiGHS
+ * implementation from highs_backend.hpp, which does not need a license.
+ *
+ * \file milp_backend.hpp
+ */
+
+#ifdef GRSTAPSE_USE_HIGHS
+// Local
+#include "grstapse/common/milp/highs/highs_backend.hpp"
+#else
+// External
+#include <gurobi_c++.h>
+#endif
\ No newline at end of file
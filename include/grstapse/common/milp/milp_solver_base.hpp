@@ -26,9 +26,9 @@
 // Global
 #include <memory>
 #include <mutex>
-// External
-#include <gurobi_c++.h>
+#include <vector>
 // Local
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/common/utilities/noncopyable.hpp"
 #include "grstapse/common/utilities/update_model_result.hpp"
 // endregion
@@ -36,6 +36,7 @@
 namespace grstapse
 {
     // region Forward Declarations
+    class Deadline;
     class ParametersBase;
     class FailureReason;
     class MilpSolverResult;
@@ -84,8 +85,39 @@ namespace grstapse
 
         [[nodiscard]] inline std::shared_ptr<GRBModel> model();
 
-        //! Clears and removes all environments
-        static void clearEnvironments();
+        /*!
+         * Sets the deadline of the search this solver is run from
+         *
+         * \note The time limit of each optimization is clamped to the deadline and an in-flight optimization is
+         *       aborted (from a callback) once the deadline expires
+         */
+        void setDeadline(const std::shared_ptr<const Deadline>& deadline);
+
+        //! Parameters that are applied to every environment in the environment pool
+        struct EnvironmentParameters
+        {
+            int threads       = 0;     //!< The number of threads used by each solve (0 lets gurobi decide)
+            double time_limit = -1.0;  //!< The time limit (in seconds) for each solve (negative for no limit)
+            //! The number of released environments kept for reuse (any others are destroyed when released)
+            unsigned int max_idle_environments = 16;
+        };
+
+        /*!
+         * Sets the parameters for all environments (existing and future)
+         *
+         * \note Model specific parameters (e.g. milp_timeout) take precedence
+         */
+        static void setEnvironmentParameters(const EnvironmentParameters& parameters);
+
+        //! \returns The number of environments in the pool
+        [[nodiscard]] static unsigned int numberOfEnvironments();
+
+        /*!
+         * Clears and removes all environments
+         *
+         * \note Environments that are still checked out by a solver are destroyed once that solver releases them
+         */
+        static void clearEnvironments() noexcept;
 
         static void checkEnvironmentErrors();
 
@@ -109,6 +141,9 @@ namespace grstapse
         //! Add constraints to the MILP \p model
         [[nodiscard]] virtual std::shared_ptr<const FailureReason> createConstraints(GRBModel& model) = 0;
 
+        //! Sets MIP start values for the variables of the MILP \p model (Default: does nothing)
+        virtual void setStartValues(GRBModel& model);
+
         /*!
          * Updates model after each run (Default: does nothing)
          *
@@ -150,6 +185,23 @@ namespace grstapse
             std::shared_ptr<GRBModel> m_model;
         };
 
+        /*!
+         * \brief Derivative of GRBCallback that aborts the optimization once the deadline expires
+         *
+         * \note Only used without benders decomposition (BendersCallback checks the deadline itself)
+         */
+        class DeadlineCallback : public GRBCallback
+        {
+           public:
+            explicit DeadlineCallback(const std::shared_ptr<const Deadline>& deadline);
+
+            //! \copydoc GRBCallback
+            void callback() override;
+
+           private:
+            std::shared_ptr<const Deadline> m_deadline;
+        };
+
         /*!
          * Make cuts to the model
          *
@@ -159,19 +211,40 @@ namespace grstapse
 
         /*!
          * \returns An environment from the environment pool (A new one may be created if one is not available)
+         *
+         * \note The environment is checked out until this solver is destroyed (or releaseEnvironment is called), so
+         *       solvers that are alive at the same time never share an environment and can solve concurrently
          */
         [[nodiscard]] GRBEnv& getEnvironment();
 
+        /*!
+         * Returns the environment checked out by this solver to the pool
+         *
+         * \note The model (and callbacks) built with the environment must be destroyed first
+         */
+        void releaseEnvironment();
+
+        //! Drops the trailing slots of the pool that are neither taken nor hold an environment
+        static void shrinkEnvironmentPool();
+
+        //! Applies s_environment_parameters to \p env
+        static void configureEnvironment(GRBEnv& env);
+
         bool m_return_feasible_on_timeout;
         bool m_benders_decomposition;
         std::unique_ptr<BendersCallback> m_benders_callback;
+        std::shared_ptr<const Deadline> m_deadline;
+        std::unique_ptr<DeadlineCallback> m_deadline_callback;
+        double m_time_limit;  //!< The time limit (in seconds) from the parameters (GRB_INFINITY for no limit)
         std::shared_ptr<GRBModel> m_model;
         unsigned int m_num_iterations;
         int m_environment_index;
 
         static std::mutex s_environment_lock;
-        static std::vector<GRBEnv> s_environment_pool;
+        static std::vector<std::unique_ptr<GRBEnv>> s_environment_pool;  //!< unique_ptr for stable addresses
         static std::vector<bool> s_environment_taken;
+        static bool s_clear_environments_on_release;  //!< Whether released environments are destroyed instead of pooled
+        static EnvironmentParameters s_environment_parameters;
     };
 
     // Inline Functions
@@ -22,8 +22,8 @@
  */
 #pragma once
 
-// External
-#include <gurobi_c++.h>
+// Local
+#include "grstapse/common/milp/milp_backend.hpp"
 
 namespace grstapse
 {
@@ -130,7 +130,7 @@ namespace grstapse
         }
 
         //! \returns The top element from the priority queue
-        [[nodiscard]] std::shared_ptr<PayloadType> top()
+        [[nodiscard]] std::shared_ptr<const PayloadType> top() const
         {
             assert(!m_heap.empty());
             return m_heap.top().payload();
@@ -59,6 +59,8 @@ namespace grstapse
                        const AStarFunctors<SearchNode>& functors)
             : Base_{parameters, functors}
             , m_path_cost(functors.path_cost)
+            , m_path_cost_time_id(
+                  Metrics::intern(parameters->template get<std::string>(constants::k_timer_name) + "_pathcost"))
         {}
 
         /*!
@@ -70,6 +72,8 @@ namespace grstapse
         explicit AStar(const std::shared_ptr<const ParametersBase>& parameters, AStarFunctors<SearchNode>&& functors)
             : Base_{parameters, functors}
             , m_path_cost(std::move(functors.path_cost))
+            , m_path_cost_time_id(
+                  Metrics::intern(parameters->template get<std::string>(constants::k_timer_name) + "_pathcost"))
         {}
 
        protected:
@@ -78,19 +82,18 @@ namespace grstapse
         {
             // Path Cost
             {
-                TimerRunner timer_runner(Base_::m_parameters->template get<std::string>(constants::k_timer_name) +
-                                         "_pathcost");
+                TimerRunner timer_runner(m_path_cost_time_id);
                 node->setG(m_path_cost->operator()(node));
             }
 
             // Heuristic
             {
-                TimerRunner timer_runner(Base_::m_parameters->template get<std::string>(constants::k_timer_name) +
-                                         "_heuristic");
+                TimerRunner timer_runner(Base_::m_heuristic_time_id);
                 node->setH(Base_::m_heuristic->operator()(node));
             }
         }
 
         std::shared_ptr<const PathCost_> m_path_cost;
+        MetricId m_path_cost_time_id;
     };
 }  // namespace grstapse
\ No newline at end of file
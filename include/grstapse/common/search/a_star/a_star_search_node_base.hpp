@@ -66,8 +66,10 @@ namespace grstapse
          * \param id A unique identifier for this node
          * \param parent The parent of this AStarSearchNodeDeriv
          */
-        AStarSearchNodeBase(const unsigned int id, const std::shared_ptr<const AStarSearchNodeDeriv>& parent = nullptr)
-            : Base_(id, parent)
+        AStarSearchNodeBase(const unsigned int id,
+                            const std::shared_ptr<const AStarSearchNodeDeriv>& parent = nullptr,
+                            SearchNodeArena* arena                                    = nullptr)
+            : Base_(id, parent, arena)
             , m_g(std::nanf(""))
         {}
 
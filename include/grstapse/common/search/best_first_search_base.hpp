@@ -25,15 +25,23 @@
 // region Includes
 // Global
 #include <cassert>
+#include <exception>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <utility>
 #include <vector>
+// External
+#include <robin_hood/robin_hood.hpp>
 // Local
 #include "grstapse/common/mutable_priority_queue/mutable_priority_queue.hpp"
 #include "grstapse/common/search/best_first_search_functors.hpp"
 #include "grstapse/common/search/best_first_search_node_base.hpp"
+#include "grstapse/common/search/search_node_arena.hpp"
 #include "grstapse/common/search/search_algorithm_base.hpp"
+#include "grstapse/common/utilities/deadline.hpp"
+#include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/common/utilities/metrics.hpp"
 #include "grstapse/common/utilities/time_keeper.hpp"
 #include "grstapse/parameters/parameters_base.hpp"
 // endregion
@@ -74,6 +82,10 @@ namespace grstapse
             , m_memoization(functors.memoization)
             , m_prepruning_method(functors.prepruning_method)
             , m_postpruning_method(functors.postpruning_method)
+            , m_arena(std::make_shared<SearchNodeArena>())
+            , m_deadline(std::make_shared<Deadline>())
+            , m_heuristic_time_id(
+                  Metrics::intern(parameters->template get<std::string>(constants::k_timer_name) + "_heuristic"))
         {}
 
         /*!
@@ -91,8 +103,23 @@ namespace grstapse
             , m_memoization{std::move(functors.memoization)}
             , m_prepruning_method{std::move(functors.prepruning_method)}
             , m_postpruning_method{std::move(functors.postpruning_method)}
+            , m_arena(std::make_shared<SearchNodeArena>())
+            , m_deadline(std::make_shared<Deadline>())
+            , m_heuristic_time_id(
+                  Metrics::intern(parameters->template get<std::string>(constants::k_timer_name) + "_heuristic"))
         {}
 
+        /*!
+         * \returns The deadline of this search
+         *
+         * \note Shared with the heuristic/scheduler/motion planners so they can stop in-flight work. It is restarted
+         *       from the timeout parameters at the beginning of each search
+         */
+        [[nodiscard]] const std::shared_ptr<Deadline>& deadline() const
+        {
+            return m_deadline;
+        }
+
         /*!
          * \brief Runs the search
          *
@@ -101,6 +128,14 @@ namespace grstapse
         SearchResults<SearchNode, SearchStatistics> searchFromNode(const std::shared_ptr<SearchNode>& root) override
         {
             assert(root);
+            // Deferred evaluation only evaluates one node at a time, so there would be nothing to parallelize
+            const unsigned int num_threads = Base_::m_parameters->template get<unsigned int>(constants::k_threads);
+            const bool lazy_evaluation     = Base_::m_parameters->template get<bool>(constants::k_lazy_evaluation);
+            if(lazy_evaluation && num_threads > 1)
+            {
+                throw createLogicError("Lazy evaluation cannot be used with multiple threads");
+            }
+
             evaluateNode(root);
             Base_::m_statistics->incrementNodesGenerated();
             m_open.push(m_memoization->operator()(root), root);
@@ -108,32 +143,64 @@ namespace grstapse
             const bool has_prepruning  = m_prepruning_method != nullptr;
             const bool has_postpruning = m_postpruning_method != nullptr;
 
-            const bool has_timeout       = Base_::m_parameters->template get<bool>(constants::k_has_timeout);
-            const std::string timer_name = Base_::m_parameters->template get<std::string>(constants::k_timer_name);
-            const float timeout          = Base_::m_parameters->template get<float>(constants::k_timeout);
+            // The named timer is only consulted once; the loop (and everything it calls) checks the deadline
+            if(Base_::m_parameters->template get<bool>(constants::k_has_timeout))
+            {
+                const std::string timer_name =
+                    Base_::m_parameters->template get<std::string>(constants::k_timer_name);
+                const float timeout = Base_::m_parameters->template get<float>(constants::k_timeout);
+                m_deadline->start(timeout - TimeKeeper::instance().time(timer_name));
+            }
+            else
+            {
+                m_deadline->clear();
+            }
 
-            const bool save_closed_nodes = Base_::m_parameters->template get<bool>(constants::k_save_closed_nodes);
-            const bool save_pruned_nodes = Base_::m_parameters->template get<bool>(constants::k_save_pruned_nodes);
+            // Low memory mode only keeps what is needed to trace the solution and avoid re-expanding nodes
+            m_low_memory                 = Base_::m_parameters->template get<bool>(constants::k_low_memory);
+            const bool save_closed_nodes = !m_low_memory &&
+                                           Base_::m_parameters->template get<bool>(constants::k_save_closed_nodes);
+            const bool save_pruned_nodes = !m_low_memory &&
+                                           Base_::m_parameters->template get<bool>(constants::k_save_pruned_nodes);
 
-            // Continue through open set until it is empty or timeout
-            // Only check timeout if parameter is set
+            // Continue through open set until it is empty or timeout (or the deadline is cancelled)
             while(!m_open.empty())
             {
                 // Timed out
-                if(has_timeout && TimeKeeper::instance().time(timer_name) > timeout)
+                if(m_deadline->expired())
                 {
                     Logger::warn("Search exceeded the timeout");
                     break;
                 }
 
                 std::shared_ptr<SearchNode> base = m_open.pop();
+                const MemoizationKey base_id     = m_memoization->operator()(base);
+
+                // Deferred evaluation: only the node at the top of the open set is evaluated exactly. If its exact
+                // value is worse than the next best node, then it goes back into the open set.
+                if(lazy_evaluation && m_deferred_ids.erase(base_id) > 0)
+                {
+                    evaluateNode(base);
+                    Base_::m_statistics->incrementNodesEvaluated();
+                    // Post-pruning only saw the optimistic value when the node was generated
+                    if(has_postpruning && m_postpruning_method->operator()(base))
+                    {
+                        prune(base_id, base, save_pruned_nodes);
+                        continue;
+                    }
+                    if(!m_open.empty() && m_open.top()->priority() < base->priority())
+                    {
+                        m_open.push(base_id, base);
+                        continue;
+                    }
+                }
 
                 // Close node before the goal check for future anytime/repair
                 if(save_closed_nodes)
                 {
                     m_closed.push_back(base);
                 }
-                m_closed_ids.insert(m_memoization->operator()(base));
+                m_closed_ids.insert(base_id);
                 base->setStatus(SearchNodeStatus::e_closed);
 
                 // Check if goal node
@@ -144,58 +211,71 @@ namespace grstapse
 
                 Base_::m_statistics->incrementNodesExpanded();
                 bool deadend = true;
-                for(std::shared_ptr<SearchNode> child: m_successor_generator->operator()(base))
+                if(num_threads > 1)
                 {
-                    deadend = false;
-                    Base_::m_statistics->incrementNodesGenerated();
-                    // Timed out
-                    if(has_timeout && TimeKeeper::instance().time(timer_name) > timeout)
+                    // Collect the children that survive pre-pruning in the order they were generated
+                    std::vector<std::pair<MemoizationKey, std::shared_ptr<SearchNode>>> children;
+                    for(std::shared_ptr<SearchNode> child: m_successor_generator->operator()(base))
                     {
-                        Logger::warn("Search timed out");
-                        break;
+                        deadend = false;
+                        Base_::m_statistics->incrementNodesGenerated();
+                        // Timed out
+                        if(m_deadline->expired())
+                        {
+                            Logger::warn("Search timed out");
+                            break;
+                        }
+
+                        const MemoizationKey id = m_memoization->operator()(child);
+                        if(preprocessChild(id, child, has_prepruning, save_pruned_nodes))
+                        {
+                            children.emplace_back(id, std::move(child));
+                        }
                     }
 
-                    const unsigned int id = m_memoization->operator()(child);
+                    // Evaluate
+                    evaluateNodes(children, num_threads);
+                    Base_::m_statistics->incrementNodesEvaluated(children.size());
 
-                    // Ignore if this node has already been closed or pruned
-                    if(m_closed_ids.find(id) != m_closed_ids.end() || m_pruned_ids.find(id) != m_pruned_ids.end())
+                    // Add to the open set in generation order so that ties are broken identically to a serial run
+                    for(auto& [id, child]: children)
                     {
-                        continue;
+                        postprocessChild(id, child, has_postpruning, save_pruned_nodes);
                     }
-
-                    // Check if the child should be pruned before evaluation
-                    if(has_prepruning && m_prepruning_method->operator()(child))
+                }
+                else
+                {
+                    for(std::shared_ptr<SearchNode> child: m_successor_generator->operator()(base))
                     {
-                        child->setStatus(SearchNodeStatus::e_pruned);
-                        Base_::m_statistics->incrementNodesPruned();
-                        m_pruned_ids.insert(id);
-                        if(save_pruned_nodes)
+                        deadend = false;
+                        Base_::m_statistics->incrementNodesGenerated();
+                        // Timed out
+                        if(m_deadline->expired())
                         {
-                            m_pruned.push_back(child);
+                            Logger::warn("Search timed out");
+                            break;
                         }
-                        continue;
-                    }
 
-                    // Evaluate
-                    evaluateNode(child);
-                    Base_::m_statistics->incrementNodesEvaluated();
+                        const MemoizationKey id = m_memoization->operator()(child);
+                        if(not preprocessChild(id, child, has_prepruning, save_pruned_nodes))
+                        {
+                            continue;
+                        }
 
-                    // Check if child should be pruned after evaluation
-                    if(has_postpruning && m_postpruning_method->operator()(child))
-                    {
-                        child->setStatus(SearchNodeStatus::e_pruned);
-                        Base_::m_statistics->incrementNodesPruned();
-                        m_pruned_ids.insert(id);
-                        if(save_pruned_nodes)
+                        // Evaluate
+                        if(lazy_evaluation)
                         {
-                            m_pruned.push_back(child);
+                            evaluateNodeOptimistically(child);
+                            m_deferred_ids.insert(id);
+                        }
+                        else
+                        {
+                            evaluateNode(child);
+                            Base_::m_statistics->incrementNodesEvaluated();
                         }
-                        continue;
-                    }
 
-                    // Add child to open set
-                    child->setStatus(SearchNodeStatus::e_open);
-                    m_open.push(id, child);
+                        postprocessChild(id, child, has_postpruning, save_pruned_nodes);
+                    }
                 }
                 if(deadend)
                 {
@@ -214,6 +294,117 @@ namespace grstapse
          */
         virtual void evaluateNode(const std::shared_ptr<SearchNode>& node) = 0;
 
+        /*!
+         * \brief Cheaply evaluates a node with a value that is no worse than the one from evaluateNode
+         *
+         * \param node The node to evaluate
+         *
+         * \note Only used when evaluation is deferred until the node reaches the top of the open set
+         */
+        virtual void evaluateNodeOptimistically(const std::shared_ptr<SearchNode>& node)
+        {
+            evaluateNode(node);
+        }
+
+        /*!
+         * \brief Evaluates a batch of children concurrently
+         *
+         * \param children The (memoization key, node) pairs to evaluate
+         * \param num_threads The number of threads to evaluate with
+         *
+         * \note evaluateNode (and therefore the heuristic) must be safe to call from multiple threads
+         */
+        void evaluateNodes(const std::vector<std::pair<MemoizationKey, std::shared_ptr<SearchNode>>>& children,
+                           unsigned int num_threads)
+        {
+            // Exceptions cannot propagate out of an OpenMP region, so the first one is rethrown afterwards
+            std::exception_ptr exception = nullptr;
+            std::mutex exception_mutex;
+            const int num_children = static_cast<int>(children.size());
+            // Workers record their timings/counts into the same metrics as this thread
+            Metrics& metrics = Metrics::current();
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 1) shared(children, exception, exception_mutex)
+            for(int i = 0; i < num_children; ++i)
+            {
+                try
+                {
+                    Metrics::Activation activation(metrics);
+                    evaluateNode(children[i].second);
+                }
+                catch(...)
+                {
+                    std::lock_guard lock(exception_mutex);
+                    if(exception == nullptr)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if(exception != nullptr)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        /*!
+         * \brief Filters a child before evaluation
+         *
+         * \returns Whether the child should be evaluated (i.e. it is new and was not pruned)
+         */
+        bool preprocessChild(MemoizationKey id,
+                             const std::shared_ptr<SearchNode>& child,
+                             bool has_prepruning,
+                             bool save_pruned_nodes)
+        {
+            // Ignore if this node has already been closed or pruned
+            if(m_closed_ids.contains(id) || m_pruned_ids.contains(id))
+            {
+                return false;
+            }
+
+            // Check if the child should be pruned before evaluation
+            if(has_prepruning && m_prepruning_method->operator()(child))
+            {
+                prune(id, child, save_pruned_nodes);
+                return false;
+            }
+            return true;
+        }
+
+        //! Either prunes an evaluated child or adds it to the open set
+        void postprocessChild(MemoizationKey id,
+                              const std::shared_ptr<SearchNode>& child,
+                              bool has_postpruning,
+                              bool save_pruned_nodes)
+        {
+            // Check if child should be pruned after evaluation
+            if(has_postpruning && m_postpruning_method->operator()(child))
+            {
+                prune(id, child, save_pruned_nodes);
+                return;
+            }
+
+            // Add child to open set
+            child->setStatus(SearchNodeStatus::e_open);
+            m_open.push(id, child);
+        }
+
+        //! Marks a child as pruned
+        void prune(MemoizationKey id, const std::shared_ptr<SearchNode>& child, bool save_pruned_nodes)
+        {
+            child->setStatus(SearchNodeStatus::e_pruned);
+            Base_::m_statistics->incrementNodesPruned();
+            // Without the record a pruned node may be generated (and pruned) again, which trades time for memory
+            if(!m_low_memory)
+            {
+                m_pruned_ids.insert(id);
+            }
+            if(save_pruned_nodes)
+            {
+                m_pruned.push_back(child);
+            }
+        }
+
         std::shared_ptr<const Heuristic_> m_heuristic;
         std::shared_ptr<const SuccessorGenerator_> m_successor_generator;
         std::shared_ptr<const GoalCheck_> m_goal_check;
@@ -221,12 +412,25 @@ namespace grstapse
         std::shared_ptr<PruningMethod_> m_prepruning_method;
         std::shared_ptr<PruningMethod_> m_postpruning_method;
 
-        MutablePriorityQueue<unsigned int, float, SearchNode> m_open;  //!< key, priority, payload
+        //! Storage (and identifiers) for the nodes of this search. Derived searches allocate their root node from it
+        std::shared_ptr<SearchNodeArena> m_arena;
+
+        //! Shared with everything called during the search so that a timeout stops in-flight work
+        std::shared_ptr<Deadline> m_deadline;
+
+        MetricId m_heuristic_time_id;  //!< Interned once so that timing each evaluation doesn't build a string
+
+        MutablePriorityQueue<MemoizationKey, float, SearchNode> m_open;  //!< key, priority, payload
 
         std::vector<std::shared_ptr<SearchNode>> m_closed;
-        std::set<unsigned int> m_closed_ids;
+        robin_hood::unordered_flat_set<MemoizationKey> m_closed_ids;
 
         std::vector<std::shared_ptr<SearchNode>> m_pruned;
-        std::set<unsigned int> m_pruned_ids;
+        robin_hood::unordered_flat_set<MemoizationKey> m_pruned_ids;
+
+        //! Nodes in the open set that only have an optimistic value
+        robin_hood::unordered_flat_set<MemoizationKey> m_deferred_ids;
+
+        bool m_low_memory = false;  //!< Whether closed/pruned nodes and pruned ids are dropped
     };
 }  // namespace grstapse
\ No newline at end of file
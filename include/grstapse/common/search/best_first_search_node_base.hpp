@@ -58,8 +58,9 @@ namespace grstapse
          * \param parent The parent of this BestFirstSearchNodeDeriv
          */
         BestFirstSearchNodeBase(const unsigned int id,
-                                const std::shared_ptr<const BestFirstSearchNodeDeriv>& parent = nullptr)
-            : Base_(id, parent)
+                                const std::shared_ptr<const BestFirstSearchNodeDeriv>& parent = nullptr,
+                                SearchNodeArena* arena                                        = nullptr)
+            : Base_(id, parent, arena)
         {}
     };
 
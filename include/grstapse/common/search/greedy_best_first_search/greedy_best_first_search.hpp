@@ -72,9 +72,15 @@ namespace grstapse
         //! Computes the heuristic value for a node
         virtual void evaluateNode(const std::shared_ptr<SearchNode>& child) final override
         {
-            TimerRunner timer_runner(Base_::m_parameters->template get<std::string>(constants::k_timer_name) +
-                                     "_heuristic");
+            TimerRunner timer_runner(Base_::m_heuristic_time_id);
             child->setH(Base_::m_heuristic->operator()(child));
         }
+
+        //! Sets the heuristic value of a node to an optimistic estimate
+        virtual void evaluateNodeOptimistically(const std::shared_ptr<SearchNode>& child) final override
+        {
+            TimerRunner timer_runner(Base_::m_heuristic_time_id);
+            child->setH(Base_::m_heuristic->optimisticEstimate(child));
+        }
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -67,8 +67,9 @@ namespace grstapse
          * \param parent The parent of this GreedyBestFirstSearchNodeDeriv
          */
         GreedyBestFirstSearchNodeBase(const unsigned int id,
-                                      const std::shared_ptr<const GreedyBestFirstSearchNodeDeriv>& parent = nullptr)
-            : Base_(id, parent)
+                                      const std::shared_ptr<const GreedyBestFirstSearchNodeDeriv>& parent = nullptr,
+                                      SearchNodeArena* arena                                              = nullptr)
+            : Base_(id, parent, arena)
             , m_h(std::nanf(""))
         {}
 
@@ -42,7 +42,7 @@ namespace grstapse
         HashMemoization() = default;
 
         //! \returns The node's unique identifier
-        [[nodiscard]] inline unsigned int operator()(const std::shared_ptr<const SearchNode>& node) const final
+        [[nodiscard]] inline MemoizationKey operator()(const std::shared_ptr<const SearchNode>& node) const final
         {
             return node->hash();
         }
@@ -47,6 +47,16 @@ namespace grstapse
         //! \returns An estimate of the distance between \p node and the goal
         [[nodiscard]] virtual float operator()(const std::shared_ptr<SearchNode>& node) const = 0;
 
+        /*!
+         * \returns A cheap estimate for \p node that never exceeds operator() (used when evaluation is deferred)
+         *
+         * \note Defaults to operator(), which makes deferring the evaluation pointless but correct
+         */
+        [[nodiscard]] virtual float optimisticEstimate(const std::shared_ptr<SearchNode>& node) const
+        {
+            return operator()(node);
+        }
+
        protected:
         HeuristicBase() = default;
     };
@@ -24,6 +24,7 @@
 
 // Global
 #include <concepts>
+#include <cstdint>
 #include <memory>
 
 // Local
@@ -32,6 +33,9 @@
 
 namespace grstapse
 {
+    //! The identifier a memoization method assigns to a node
+    using MemoizationKey = std::uint64_t;
+
     /*!
      * \brief An interface for defining how to determine if two nodes are the same
      *
@@ -42,7 +46,7 @@ namespace grstapse
     {
        public:
         //! \returns An identifier for \p node
-        [[nodiscard]] virtual unsigned int operator()(const std::shared_ptr<const SearchNode>& node) const = 0;
+        [[nodiscard]] virtual MemoizationKey operator()(const std::shared_ptr<const SearchNode>& node) const = 0;
 
         //! \returns Whether \p lhs and \p rhs have the same identifier (representing they are the same node)
         [[nodiscard]] virtual bool equal(const std::shared_ptr<const SearchNode>& lhs,
@@ -40,7 +40,7 @@ namespace grstapse
         NullMemoization() = default;
 
         //! \returns The node's unique identifier
-        [[nodiscard]] unsigned int operator()(const std::shared_ptr<const SearchNode>& node) const final override
+        [[nodiscard]] MemoizationKey operator()(const std::shared_ptr<const SearchNode>& node) const final override
         {
             return node->id();
         }
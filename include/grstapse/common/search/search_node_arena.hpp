@@ -0,0 +1,204 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
+
+namespace grstapse
+{
+    /*!
+     * \brief Chunked storage for the nodes of a single search
+     *
+     * Nodes are carved out of large chunks instead of being individually heap allocated. Each thread carves from a
+     * chunk of its own, so only fetching a new chunk takes a lock. Released memory is kept on a free list per size
+     * class and reused by later allocations of the same size class, so pruned and duplicate nodes do not grow the
+     * arena. All of the chunks are released together once the search and every node allocated from the arena have
+     * been destroyed (each node's control block keeps the arena alive through its allocator).
+     *
+     * The arena also hands out the 32-bit identifiers of its nodes, so identifiers are unique per search and searches
+     * can run concurrently in different threads.
+     *
+     * \note Requests larger than k_max_pooled_size (or with an alignment larger than k_granularity) go directly to
+     *       the global allocator
+     *
+     * \see allocateSearchNode
+     */
+    class SearchNodeArena
+        : public std::enable_shared_from_this<SearchNodeArena>
+        , private Noncopyable
+    {
+       public:
+        static constexpr std::size_t k_default_chunk_size = 1 << 16;
+        static constexpr std::size_t k_granularity        = alignof(std::max_align_t);
+        static constexpr std::size_t k_max_pooled_size    = 1024;
+
+        //! Constructor (the chunk size is at least k_max_pooled_size)
+        explicit SearchNodeArena(std::size_t chunk_size = k_default_chunk_size);
+
+        //! \returns Uninitialized memory of \p bytes with an alignment of \p alignment
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment);
+
+        //! Releases memory from allocate (with the same \p bytes and \p alignment) for reuse
+        void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept;
+
+        //! \returns The next identifier for a node of this search
+        [[nodiscard]] inline unsigned int nextId();
+
+        //! \returns The number of identifiers that have been handed out
+        [[nodiscard]] inline unsigned int numberOfIds() const;
+
+        //! \returns The number of chunks that have been allocated
+        [[nodiscard]] std::size_t numberOfChunks() const;
+
+       private:
+        static constexpr std::size_t k_num_size_classes = k_max_pooled_size / k_granularity;
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+        using FreeLists = std::array<FreeBlock*, k_num_size_classes>;
+
+        //! The chunk and free lists of a thread for the arena it last allocated from
+        struct ThreadCache
+        {
+            std::uint64_t arena_id = 0;  //!< 0 if the thread has not used an arena
+            std::byte* cursor      = nullptr;
+            std::size_t remaining  = 0;
+            FreeLists free_lists{};
+        };
+
+        //! \returns Whether a request is served from the chunks
+        [[nodiscard]] static inline bool isPooled(std::size_t bytes, std::size_t alignment);
+
+        //! \returns The size class of a pooled request of \p bytes
+        [[nodiscard]] static inline std::size_t sizeClass(std::size_t bytes);
+
+        //! Arenas are identified by a counter rather than their address, so a destroyed arena is never mistaken for a
+        //! new one at the same address
+        static std::atomic<std::uint64_t> s_next_arena_id;
+        static thread_local ThreadCache s_thread_cache;
+
+        const std::uint64_t m_id;
+        std::size_t m_chunk_size;
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        FreeLists m_free_lists;  //!< Memory released by threads that are not using this arena
+        std::atomic<std::size_t> m_num_free;
+        mutable std::mutex m_mutex;
+        std::atomic<unsigned int> m_next_id;
+    };
+
+    /*!
+     * \brief A std allocator that allocates from a SearchNodeArena
+     *
+     * Deallocated memory is reused by the arena; it is returned to the system when the arena is destroyed
+     */
+    template <typename T>
+    class SearchNodeArenaAllocator
+    {
+       public:
+        using value_type = T;
+
+        //! Constructor
+        explicit SearchNodeArenaAllocator(std::shared_ptr<SearchNodeArena> arena)
+            : m_arena(std::move(arena))
+        {}
+
+        //! Rebind constructor
+        template <typename U>
+        SearchNodeArenaAllocator(const SearchNodeArenaAllocator<U>& rhs)
+            : m_arena(rhs.arena())
+        {}
+
+        //! \returns Memory for \p n objects of type T
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        //! Returns the memory of \p n objects of type T to the arena
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            m_arena->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        //! \returns The arena being allocated from
+        [[nodiscard]] inline const std::shared_ptr<SearchNodeArena>& arena() const
+        {
+            return m_arena;
+        }
+
+        //! Equality operator
+        template <typename U>
+        [[nodiscard]] bool operator==(const SearchNodeArenaAllocator<U>& rhs) const
+        {
+            return m_arena == rhs.arena();
+        }
+
+       private:
+        std::shared_ptr<SearchNodeArena> m_arena;
+    };
+
+    /*!
+     * \brief Creates a search node (and its control block) in \p arena
+     *
+     * \tparam SearchNode The type of node to create
+     */
+    template <typename SearchNode, typename... Args>
+    [[nodiscard]] std::shared_ptr<SearchNode> allocateSearchNode(SearchNodeArena& arena, Args&&... args)
+    {
+        return std::allocate_shared<SearchNode>(SearchNodeArenaAllocator<SearchNode>(arena.shared_from_this()),
+                                                std::forward<Args>(args)...);
+    }
+
+    // Inline Functions
+    bool SearchNodeArena::isPooled(std::size_t bytes, std::size_t alignment)
+    {
+        return bytes <= k_max_pooled_size && alignment <= k_granularity;
+    }
+
+    std::size_t SearchNodeArena::sizeClass(std::size_t bytes)
+    {
+        return bytes == 0 ? 0 : (bytes - 1) / k_granularity;
+    }
+
+    unsigned int SearchNodeArena::nextId()
+    {
+        return m_next_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    unsigned int SearchNodeArena::numberOfIds() const
+    {
+        return m_next_id.load(std::memory_order_relaxed);
+    }
+}  // namespace grstapse
\ No newline at end of file
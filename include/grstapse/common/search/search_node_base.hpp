@@ -36,6 +36,7 @@ namespace grstapse
 {
     // Forward Declarations
     class ProblemInputs;
+    class SearchNodeArena;
 
     /*!
      * Marks the status of a node
@@ -82,6 +83,16 @@ namespace grstapse
             return m_id;
         }
 
+        /*!
+         * \returns The arena this node was allocated from (nullptr if it was not)
+         *
+         * \note Successors should be allocated from the same arena
+         */
+        [[nodiscard]] inline SearchNodeArena* arena() const
+        {
+            return m_arena;
+        }
+
         //! \returns The hash identifier for this node
         [[nodiscard]] virtual unsigned int hash() const = 0;
 
@@ -95,15 +106,20 @@ namespace grstapse
          *
          * \param id A unique identifier for this node
          * \param parent The parent of this SearchNodeDerive
+         * \param arena The arena this node is allocated from (the node does not own it)
          */
-        SearchNodeBase(const unsigned int id, const std::shared_ptr<const SearchNodeDeriv>& parent = nullptr)
+        SearchNodeBase(const unsigned int id,
+                       const std::shared_ptr<const SearchNodeDeriv>& parent = nullptr,
+                       SearchNodeArena* arena                               = nullptr)
             : m_id(id)
             , m_parent(parent)
+            , m_arena(arena)
             , m_status(SearchNodeStatus::e_new)
         {}
 
         unsigned int m_id;
         std::shared_ptr<const SearchNodeDeriv> m_parent;
+        SearchNodeArena* m_arena;
         SearchNodeStatus m_status;
     };
 
@@ -38,8 +38,10 @@ namespace grstapse::constants
     CREATE_JSON_KEY(algorithm_parameters)
     CREATE_JSON_KEY(allocation)
     CREATE_JSON_KEY(alpha)
+    CREATE_JSON_KEY(batch_norm)
     CREATE_JSON_KEY(best_schedule)
     CREATE_JSON_KEY(beta)
+    CREATE_JSON_KEY(bias)
     CREATE_JSON_KEY(bounding_radius)
     CREATE_JSON_KEY(bounds)
     CREATE_JSON_KEY(coalition)
@@ -54,12 +56,19 @@ namespace grstapse::constants
     CREATE_JSON_KEY(domain_filepath)
     CREATE_JSON_KEY(dubins)
     CREATE_JSON_KEY(duration)
+    CREATE_JSON_KEY(edge_batch_norm)
+    CREATE_JSON_KEY(edge_destination)
+    CREATE_JSON_KEY(edge_embedding)
+    CREATE_JSON_KEY(edge_self)
+    CREATE_JSON_KEY(edge_source)
     CREATE_JSON_KEY(edges)
     CREATE_JSON_KEY(environment_parameters)
+    CREATE_JSON_KEY(eps)
     CREATE_JSON_KEY(execution_motion_plan)
     CREATE_JSON_KEY(fcpop_parameters)
     CREATE_JSON_KEY(finish_timepoint)
     CREATE_JSON_KEY(gamma)
+    CREATE_JSON_KEY(gnn_weights_filepath)
     CREATE_JSON_KEY(goal_type)
     CREATE_JSON_KEY(graph_filepath)
     CREATE_JSON_KEY(graph_type)
@@ -74,8 +83,11 @@ namespace grstapse::constants
     CREATE_JSON_KEY(is_complete)
     CREATE_JSON_KEY(itags_parameters)
     CREATE_JSON_KEY(last_edge)
+    CREATE_JSON_KEY(layers)
+    CREATE_JSON_KEY(lazy_evaluation)
     CREATE_JSON_KEY(linear_quality_coefficients)
     CREATE_JSON_KEY(low)
+    CREATE_JSON_KEY(low_memory)
     CREATE_JSON_KEY(low_level_timer_name)
     CREATE_JSON_KEY(makespan)
     CREATE_JSON_KEY(masked)
@@ -95,6 +107,10 @@ namespace grstapse::constants
     CREATE_JSON_KEY(mp_type)
     CREATE_JSON_KEY(mutex_constraints)
     CREATE_JSON_KEY(name)
+    CREATE_JSON_KEY(node_batch_norm)
+    CREATE_JSON_KEY(node_embedding)
+    CREATE_JSON_KEY(node_neighbor)
+    CREATE_JSON_KEY(node_self)
     CREATE_JSON_KEY(nodes_deadend)
     CREATE_JSON_KEY(nodes_evaluated)
     CREATE_JSON_KEY(nodes_expanded)
@@ -103,6 +119,7 @@ namespace grstapse::constants
     CREATE_JSON_KEY(nodes_reopened)
     CREATE_JSON_KEY(num_motion_plan_failures)
     CREATE_JSON_KEY(num_motion_plans)
+    CREATE_JSON_KEY(num_reduced_scenarios)
     CREATE_JSON_KEY(num_scenarios)
     CREATE_JSON_KEY(num_scheduling_failures)
     CREATE_JSON_KEY(num_scheduling_iterations)
@@ -124,18 +141,24 @@ namespace grstapse::constants
     CREATE_JSON_KEY(qx)
     CREATE_JSON_KEY(qy)
     CREATE_JSON_KEY(qz)
+    CREATE_JSON_KEY(readout)
+    CREATE_JSON_KEY(readout_layers)
     CREATE_JSON_KEY(rebuild)
+    CREATE_JSON_KEY(residual)
     CREATE_JSON_KEY(resolution)
     CREATE_JSON_KEY(return_feasible_on_timeout)
     CREATE_JSON_KEY(robot_traits_matrix_reduction)
     CREATE_JSON_KEY(robots)
     CREATE_JSON_KEY(rotation)
+    CREATE_JSON_KEY(running_mean)
+    CREATE_JSON_KEY(running_var)
     CREATE_JSON_KEY(save_closed_nodes)
     CREATE_JSON_KEY(save_pruned_nodes)
     CREATE_JSON_KEY(scheduler_parameters)
     CREATE_JSON_KEY(scheduler_type)
     CREATE_JSON_KEY(scheduling_time)
     CREATE_JSON_KEY(search_parameters)
+    CREATE_JSON_KEY(seed)
     CREATE_JSON_KEY(simplify_path)
     CREATE_JSON_KEY(simplify_path_timeout)
     CREATE_JSON_KEY(solution)
@@ -162,6 +185,7 @@ namespace grstapse::constants
     CREATE_JSON_KEY(transitions)
     CREATE_JSON_KEY(turning_radius)
     CREATE_JSON_KEY(use_data_dir)
+    CREATE_JSON_KEY(use_edge_features)
     CREATE_JSON_KEY(use_hierarchical_objective)
     CREATE_JSON_KEY(use_reverse)
     CREATE_JSON_KEY(use_sprt)
@@ -171,6 +195,8 @@ namespace grstapse::constants
     CREATE_JSON_KEY(vertex_b)
     CREATE_JSON_KEY(vertices)
     CREATE_JSON_KEY(w)
+    CREATE_JSON_KEY(warm_start)
+    CREATE_JSON_KEY(weight)
     CREATE_JSON_KEY(worst_schedule)
     CREATE_JSON_KEY(x)
     CREATE_JSON_KEY(y)
@@ -214,5 +240,7 @@ namespace grstapse::constants
     constexpr std::string_view k_stochastic_milp_scheduler_parameters = "StochasticMilpSchedulerParameters";
     constexpr std::string_view k_gnn_heuristic_approximation_stochastic_scheduler_parameters =
         "GnnHeuristicApproximationStochasticSchedulerParameters";
+    constexpr std::string_view k_native_gnn_heuristic_approximation_stochastic_scheduler_parameters =
+        "NativeGnnHeuristicApproximationStochasticSchedulerParameters";
     // endregion
 }  // namespace grstapse::constants
\ No newline at end of file
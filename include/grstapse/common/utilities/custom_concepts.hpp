@@ -24,8 +24,8 @@
 
 // Global
 #include <concepts>
-// External
-#include <gurobi_c++.h>
+// Local
+#include "grstapse/common/milp/milp_backend.hpp"
 
 /*!
  * \file concepts_extension.hpp
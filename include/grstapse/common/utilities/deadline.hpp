@@ -0,0 +1,95 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// region Includes
+// Global
+#include <atomic>
+#include <chrono>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
+// endregion
+
+namespace grstapse
+{
+    /*!
+     * \brief A point in time after which a search (and everything it calls into) should stop
+     *
+     * Created once per search and shared with the heuristic, schedulers and motion planners so that hot loops can
+     * check for a timeout with a single clock comparison instead of looking up a named timer. A deadline can also be
+     * cancelled explicitly (from any thread), which expires it immediately.
+     *
+     * \see TimeKeeper
+     */
+    class Deadline : public Noncopyable
+    {
+       public:
+        //! \brief Default Constructor (never expires unless cancelled)
+        Deadline();
+
+        /*!
+         * \brief Starts a new deadline \p seconds from now and clears any previous cancellation
+         *
+         * \note Not thread safe with respect to readers; call before the deadline is shared with workers
+         */
+        void start(float seconds);
+
+        //! \brief Removes the deadline and clears any previous cancellation
+        void clear();
+
+        //! \brief Expires the deadline immediately
+        void cancel();
+
+        //! \returns Whether the deadline was explicitly cancelled
+        [[nodiscard]] inline bool cancelled() const;
+
+        //! \returns Whether the deadline has passed or was cancelled
+        [[nodiscard]] inline bool expired() const;
+
+        //! \returns Whether a finite deadline has been set
+        [[nodiscard]] inline bool isSet() const;
+
+        //! \returns The number of seconds until the deadline (0 if expired, infinity if never)
+        [[nodiscard]] float remaining() const;
+
+       private:
+        std::chrono::steady_clock::time_point m_time_point;
+        std::atomic<bool> m_cancelled;
+    };
+
+    // Inline functions
+    bool Deadline::cancelled() const
+    {
+        return m_cancelled.load(std::memory_order_relaxed);
+    }
+
+    bool Deadline::expired() const
+    {
+        return cancelled() || std::chrono::steady_clock::now() >= m_time_point;
+    }
+
+    bool Deadline::isSet() const
+    {
+        return m_time_point != std::chrono::steady_clock::time_point::max();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// region Includes
+// Global
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
+// endregion
+
+namespace grstapse
+{
+    //! Identifier of an interned metric name
+    using MetricId = unsigned int;
+
+    /*!
+     * \brief A set of named timers and counters (e.g. for a single problem or search)
+     *
+     * Each thread records into its own accumulator, so recording only takes a lock the first time a thread uses a
+     * Metrics. Values are merged across threads when they are read.
+     *
+     * Metrics are recorded into the Metrics that is active on the calling thread (see Activation), or into a process
+     * wide default if none is. Running each problem with its own active Metrics keeps parallel or consecutive runs in
+     * one process from corrupting each other's timings and counts.
+     *
+     * \note Work handed to other threads (e.g. OpenMP regions) has to activate the Metrics of the caller
+     *
+     * \see TimeKeeper
+     * \see TimerRunner
+     */
+    class Metrics : public Noncopyable
+    {
+       public:
+        //! Constructor
+        Metrics();
+
+        /*!
+         * \returns The identifier for \p name (registering it if necessary)
+         *
+         * \note Takes a lock, so hot code should intern its names once and keep the identifiers
+         */
+        [[nodiscard]] static MetricId intern(std::string_view name);
+
+        //! \returns The identifier for \p name if it has been registered
+        [[nodiscard]] static std::optional<MetricId> find(std::string_view name);
+
+        //! \returns The name of the metric with identifier \p id
+        [[nodiscard]] static std::string name(MetricId id);
+
+        //! \returns The Metrics that is active on the calling thread (or the process wide default)
+        [[nodiscard]] static Metrics& current();
+
+        //! \returns The process wide default Metrics
+        [[nodiscard]] static Metrics& global();
+
+        //! Adds \p amount to the metric \p id
+        void increment(MetricId id, double amount = 1.0);
+
+        /*!
+         * Starts timing metric \p id on the calling thread
+         *
+         * \note Nested timers for the same metric on the same thread are only counted once
+         */
+        void startTimer(MetricId id);
+
+        //! Stops timing metric \p id on the calling thread and adds the elapsed time (in seconds)
+        void stopTimer(MetricId id);
+
+        //! \returns The value of metric \p id merged across threads (including timers that are still running)
+        [[nodiscard]] double value(MetricId id) const;
+
+        //! \returns Whether metric \p id has been recorded (or is being timed)
+        [[nodiscard]] bool contains(MetricId id) const;
+
+        //! Sets metric \p id back to zero (increments racing with the reset are kept or cleared, never lost)
+        void reset(MetricId id);
+
+        //! Sets all metrics back to zero
+        void resetAll();
+
+        //! Sets metric \p id back to zero and marks it as not recorded
+        void remove(MetricId id);
+
+        //! Sets all metrics back to zero and marks them as not recorded
+        void removeAll();
+
+        //! \returns Whether a timer is running for any metric on any thread
+        [[nodiscard]] bool hasRunningTimers() const;
+
+        /*!
+         * \brief Makes a Metrics active on the calling thread for the lifetime of this object
+         *
+         * \note Restores the previously active Metrics when destroyed, so activations can be nested
+         */
+        class Activation : public Noncopyable
+        {
+           public:
+            //! Constructor
+            explicit Activation(Metrics& metrics);
+
+            //! Destructor
+            ~Activation();
+
+           private:
+            Metrics* m_previous;
+        };
+
+       private:
+        static constexpr unsigned int k_block_size = 64;
+
+        //! The values of k_block_size consecutive metrics recorded by a single thread
+        struct Block
+        {
+            Block();
+
+            std::array<std::atomic<double>, k_block_size> values;
+            std::array<std::atomic<std::int64_t>, k_block_size> timer_starts;  //!< k_not_running if not timing
+            std::array<unsigned int, k_block_size> timer_depths;               //!< Only accessed by the owner
+            std::array<std::atomic<bool>, k_block_size> recorded;
+        };
+
+        /*!
+         * \brief The values recorded by a single thread
+         *
+         * Blocks are only added by the owner while holding m_mutex and are never moved, so the owner can access them
+         * without the lock and other threads can read them while holding it.
+         */
+        struct Accumulator
+        {
+            explicit Accumulator(std::thread::id owner);
+
+            std::thread::id owner;
+            std::deque<Block> blocks;
+        };
+
+        static constexpr std::int64_t k_not_running = std::numeric_limits<std::int64_t>::min();
+
+        //! \returns The accumulator for the calling thread (created on first use)
+        [[nodiscard]] Accumulator& local();
+
+        //! \returns The block of the calling thread that holds metric \p id (created on first use)
+        [[nodiscard]] Block& localBlock(MetricId id);
+
+        //! \returns The block of \p accumulator that holds metric \p id, or nullptr if it was never recorded
+        [[nodiscard]] static Block* findBlock(Accumulator& accumulator, MetricId id);
+
+        const std::uint64_t m_serial;  //!< Unique for every Metrics ever created (addresses can be reused)
+        mutable std::mutex m_mutex;    //!< Guards m_accumulators
+        std::vector<std::unique_ptr<Accumulator>> m_accumulators;
+    };
+}  // namespace grstapse
\ No newline at end of file
@@ -24,17 +24,21 @@
 
 // Global
 #include <string>
-#include <unordered_map>
 // Local
+#include "grstapse/common/utilities/metrics.hpp"
 #include "grstapse/common/utilities/noncopyable.hpp"
-#include "grstapse/common/utilities/timer.hpp"
 
 namespace grstapse
 {
     /*!
-     * \brief Global singleton that stores the times for named timers
+     * \brief Global singleton that provides access to the times for named timers
      *
-     * \see Timer
+     * \note The times are stored in the Metrics that is active on the calling thread (see Metrics::Activation), so
+     *       separate problems can be timed separately within one process. Recording is done per thread without
+     *       locking, so timers can be run from multiple threads (e.g. parallel node evaluation)
+     *
+     * \see Metrics
+     * \see TimerRunner
      */
     class TimeKeeper : public Noncopyable
     {
@@ -42,12 +46,6 @@ namespace grstapse
         //! \returns The singleton instance of this class
         static TimeKeeper& instance();
 
-        //!
-        void setActive(const std::string& timer_name, Timer* timer);
-
-        //!
-        void setInactive(const std::string& timer_name, Timer* timer);
-
         //! Resets a timer of name \p timer_name
         void reset(const std::string& timer_name);
 
@@ -63,13 +61,17 @@ namespace grstapse
         //! \returns The value for a named timer
         [[nodiscard]] float time(const std::string& timer_name) const;
 
+        //! \returns The value for the timer with the interned identifier \p timer_id
+        [[nodiscard]] float time(MetricId timer_id) const;
+
         void increment(const std::string& timer_name, float amount);
 
        private:
         //! Constructor
         TimeKeeper() = default;
-        std::unordered_map<std::string, float> m_times;
-        std::unordered_multimap<std::string, Timer*> m_currently_active_timers;
+
+        //! \returns The identifier for \p timer_name or throws if no such timer has been recorded
+        [[nodiscard]] static MetricId recordedId(const std::string& timer_name, const char* request);
     };
 
 }  // namespace grstapse
\ No newline at end of file
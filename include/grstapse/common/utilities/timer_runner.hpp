@@ -27,14 +27,15 @@
 #include <optional>
 #include <string>
 // Local
-#include "grstapse/common/utilities/timer.hpp"
+#include "grstapse/common/utilities/metrics.hpp"
 
 namespace grstapse
 {
     /*!
-     * \brief A runner for the Timer
+     * \brief Times its own lifetime into a named timer of the currently active Metrics
      *
-     * \see Timer
+     * \see Metrics
+     * \see TimeKeeper
      */
     class TimerRunner
     {
@@ -42,17 +43,25 @@ namespace grstapse
         /*!
          * \brief Constructor
          *
-         * \param timer The timer to use
          * \param name The name of the timer
+         *
+         * \note Interns \p name, so prefer the identifier constructor in hot code
          */
         TimerRunner(const std::string& name);
 
+        /*!
+         * \brief Constructor
+         *
+         * \param id The interned identifier of the timer
+         */
+        explicit TimerRunner(MetricId id);
+
         //! Destructor
         ~TimerRunner();
 
        private:
-        Timer m_timer;
-        std::string m_name;
+        Metrics* m_metrics;  //!< The metrics that were active when the timer started
+        MetricId m_id;
     };
 
     /*!
@@ -48,6 +48,9 @@ namespace grstapse
         //! Equality operator
         [[nodiscard]] virtual bool operator==(const ConfigurationBase& rhs) const = 0;
 
+        //! \returns A hash of this configuration that is consistent with operator==
+        [[nodiscard]] virtual std::size_t hash() const = 0;
+
         //! \returns
         [[nodiscard]] inline ConfigurationType configurationType() const;
 
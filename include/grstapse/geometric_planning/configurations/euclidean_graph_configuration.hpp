@@ -60,6 +60,9 @@ namespace grstapse
         //! Equality operator
         [[nodiscard]] bool operator==(const EuclideanGraphConfiguration& rhs) const;
 
+        //! \copydoc ConfigurationBase
+        [[nodiscard]] std::size_t hash() const final override;
+
        private:
         float m_x;
         float m_y;
@@ -55,6 +55,9 @@ namespace grstapse
         //! Equality Operator
         [[nodiscard]] bool operator==(const Se2StateOmplConfiguration& rhs) const;
 
+        //! \copydoc ConfigurationBase
+        [[nodiscard]] std::size_t hash() const final override;
+
         //! \copydoc ConfigurationBase
         [[nodiscard]] float euclideanDistance(const ConfigurationBase& rhs) const final override;
 
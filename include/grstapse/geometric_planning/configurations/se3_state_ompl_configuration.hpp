@@ -79,6 +79,9 @@ namespace grstapse
         //! Equality operator
         [[nodiscard]] bool operator==(const Se3StateOmplConfiguration& rhs) const;
 
+        //! \copydoc ConfigurationBase
+        [[nodiscard]] std::size_t hash() const final override;
+
         //! \copydoc ConfigurationBase
         [[nodiscard]] float euclideanDistance(const ConfigurationBase& rhs) const final override;
 
@@ -22,6 +22,8 @@
  */
 #pragma once
 
+// Global
+#include <atomic>
 // Local
 #include "grstapse/common/search/a_star/a_star_search_node_base.hpp"
 #include "grstapse/geometric_planning/grid/grid_cell.hpp"
@@ -52,6 +54,6 @@ namespace grstapse
         nlohmann::json serializeToJson(const std::shared_ptr<const ProblemInputs>& problem_inputs) const override;
 
        private:
-        static unsigned int s_next_id;
+        static std::atomic<unsigned int> s_next_id;
     };
 }  // namespace grstapse
\ No newline at end of file
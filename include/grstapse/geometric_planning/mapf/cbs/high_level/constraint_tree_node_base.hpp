@@ -23,6 +23,7 @@
 #pragma once
 
 // Global
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -128,7 +129,7 @@ namespace grstapse
         unsigned int m_num_robots;
         ConstraintTreeNodeCostType m_cost_type;
 
-        static unsigned int s_next_id;
+        static std::atomic<unsigned int> s_next_id;
 
         friend class ConstraintTreeNode;
     };
@@ -23,6 +23,7 @@
 #pragma once
 
 // Global
+#include <atomic>
 #include <memory>
 // Local
 #include "grstapse/common/search/a_star/a_star_search_node_base.hpp"
@@ -58,6 +59,6 @@ namespace grstapse
         nlohmann::json serializeToJson(const std::shared_ptr<const ProblemInputs>& problem_inputs) const override;
 
        private:
-        static unsigned int s_next_id;
+        static std::atomic<unsigned int> s_next_id;
     };
 }  // namespace grstapse
\ No newline at end of file
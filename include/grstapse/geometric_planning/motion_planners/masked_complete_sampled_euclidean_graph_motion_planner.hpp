@@ -63,6 +63,11 @@ namespace grstapse
             const std::shared_ptr<const ParametersBase>& parameters,
             const std::shared_ptr<SampledEuclideanGraphEnvironment>& environment);
 
+        /*!
+         * \brief Restricts the queries to the scenarios in \p mask (indices are renumbered in order)
+         *
+         * \note Not thread safe: the mask is shared by every scheduler that uses this motion planner
+         */
         void setMask(const std::vector<bool>& mask);
 
         [[nodiscard]] inline unsigned int numMasked() const;
@@ -23,10 +23,15 @@
 #pragma once
 
 // Global
-#include <map>
+#include <array>
+#include <atomic>
+#include <future>
 #include <memory>
 #include <mutex>
+// External
+#include <robin_hood/robin_hood.hpp>
 // Local
+#include "grstapse/common/utilities/metrics.hpp"
 #include "grstapse/common/utilities/noncopyable.hpp"
 #include "grstapse/common/utilities/timer.hpp"
 #include "grstapse/species.hpp"
@@ -34,6 +39,7 @@
 namespace grstapse
 {
     // region Forward Declarations
+    class Deadline;
     class EnvironmentBase;
     class ParametersBase;
     class MotionPlannerQueryResultBase;
@@ -109,10 +115,38 @@ namespace grstapse
         //! Clears the cache of previously computed motion plans
         void clearCache();
 
+        /*!
+         * Sets the deadline of the search that this motion planner is queried from
+         *
+         * \note Planners that support it stop an in-flight query once the deadline expires. Results of queries that
+         *       were cut short by the deadline are not memoized
+         */
+        inline void setDeadline(const std::shared_ptr<const Deadline>& deadline);
+
+        /*!
+         * \brief Sets the deadline of a motion planner for the lifetime of the guard
+         *
+         * The previous deadline is restored when the guard is destroyed, so a search does not leave its (possibly
+         * expired) deadline on a motion planner that outlives it
+         */
+        class DeadlineGuard : public Noncopyable
+        {
+           public:
+            //! Constructor
+            DeadlineGuard(MotionPlannerBase& motion_planner, const std::shared_ptr<const Deadline>& deadline);
+
+            //! Destructor
+            ~DeadlineGuard();
+
+           private:
+            MotionPlannerBase& m_motion_planner;
+            std::shared_ptr<const Deadline> m_previous_deadline;
+        };
+
         //! \returns The number of motion plans computed
         [[nodiscard]] inline unsigned int numMotionPlans() const;
 
-        //! \returns The number of times motion planning failed to find a solution
+        //! \returns The number of times motion planning failed to find a solution (in the active Metrics)
         [[nodiscard]] static unsigned int numFailures();
 
        protected:
@@ -138,22 +172,66 @@ namespace grstapse
          * \param goal_configuration The target geometric configuration of the robot
          *
          * \returns The computed motion planning result
+         *
+         * \note Called outside of any memoization lock, so queries for different configurations may run concurrently
          */
         [[nodiscard]] virtual std::shared_ptr<const MotionPlannerQueryResultBase> computeMotionPlan(
             const std::shared_ptr<const Species>& species,
             const std::shared_ptr<const ConfigurationBase>& initial_configuration,
             const std::shared_ptr<const ConfigurationBase>& goal_configuration) = 0;
 
-        using MemoizationValue = std::tuple<std::shared_ptr<const ConfigurationBase>,
-                                            std::shared_ptr<const ConfigurationBase>,
-                                            std::shared_ptr<const MotionPlannerQueryResultBase>>;
+        //! Identifies a motion planning query by the species and the pair of configurations
+        struct MemoizationKey
+        {
+            std::weak_ptr<const Species> species;
+            std::shared_ptr<const ConfigurationBase> initial_configuration;
+            std::shared_ptr<const ConfigurationBase> goal_configuration;
+            std::size_t hash;
+        };
+
+        //! Hash functor for MemoizationKey
+        struct MemoizationKeyHash
+        {
+            [[nodiscard]] inline std::size_t operator()(const MemoizationKey& key) const;
+        };
+
+        //! Equality functor for MemoizationKey
+        struct MemoizationKeyEqual
+        {
+            [[nodiscard]] bool operator()(const MemoizationKey& lhs, const MemoizationKey& rhs) const;
+        };
+
+        //! Either a computed result or one that is still being computed by another thread
+        using MemoizationValue = std::shared_future<std::shared_ptr<const MotionPlannerQueryResultBase>>;
+
+        //! A portion of the memoization table that is guarded by its own lock
+        struct MemoizationShard
+        {
+            mutable std::mutex mutex;
+            robin_hood::unordered_node_map<MemoizationKey, MemoizationValue, MemoizationKeyHash, MemoizationKeyEqual>
+                memoization;
+        };
+
+        static constexpr unsigned int k_num_memoization_shards = 16;
+
+        //! \returns The key for a query from \p initial_configuration to \p goal_configuration
+        [[nodiscard]] static MemoizationKey createMemoizationKey(
+            const std::shared_ptr<const Species>& species,
+            const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+            const std::shared_ptr<const ConfigurationBase>& goal_configuration);
+
+        //! \returns The shard of the memoization table that \p key belongs to
+        [[nodiscard]] inline MemoizationShard& memoizationShard(const MemoizationKey& key) const;
 
         std::shared_ptr<const ParametersBase> m_parameters;
         std::shared_ptr<EnvironmentBase> m_environment;
-        std::multimap<std::weak_ptr<const Species>, MemoizationValue, std::owner_less<>> m_memoization;
-        mutable std::mutex m_mutex;  //!< mutable so that it can be used to lock const functions
+        std::shared_ptr<const Deadline> m_deadline;
+        mutable std::array<MemoizationShard, k_num_memoization_shards> m_memoization_shards;
+        std::atomic<unsigned int> m_num_motion_plans;
+        mutable std::mutex m_mutex;  //!< Guards the state of derived planners that cannot plan concurrently
 
-        static unsigned int s_num_failures;
+        static const MetricId s_num_failures_id;
+        static const MetricId s_motion_planning_time_id;
     };
 
     // Inline Functions
@@ -167,8 +245,23 @@ namespace grstapse
         return m_environment;
     }
 
+    void MotionPlannerBase::setDeadline(const std::shared_ptr<const Deadline>& deadline)
+    {
+        m_deadline = deadline;
+    }
+
     unsigned int MotionPlannerBase::numMotionPlans() const
     {
-        return m_memoization.size();
+        return m_num_motion_plans;
+    }
+
+    std::size_t MotionPlannerBase::MemoizationKeyHash::operator()(const MemoizationKey& key) const
+    {
+        return key.hash;
+    }
+
+    MotionPlannerBase::MemoizationShard& MotionPlannerBase::memoizationShard(const MemoizationKey& key) const
+    {
+        return m_memoization_shards[key.hash % k_num_memoization_shards];
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -111,6 +111,12 @@ namespace grstapse
             m_internal.at(key).get_to<T>(v);
         }
 
+        //! \returns The underlying json of the parameters
+        [[nodiscard]] inline const nlohmann::json& json() const
+        {
+            return m_internal;
+        }
+
        protected:
         nlohmann::json m_internal;
 
@@ -88,6 +88,8 @@ namespace grstapse
         //// Motion Planners
         [[nodiscard]] inline const std::vector<std::shared_ptr<MotionPlannerBase>>& motionPlanners() const;
         [[nodiscard]] inline const std::shared_ptr<MotionPlannerBase>& motionPlanner(unsigned int index) const;
+        //! \returns A hash of the json the motion planners and their environments were loaded from
+        [[nodiscard]] inline std::size_t motionPlannersHash() const;
 
         //! Checks if \p configuration matches the previously loaded environments
         void checkConfiguration(const std::shared_ptr<const ConfigurationBase>& configuration) const;
@@ -121,6 +123,7 @@ namespace grstapse
         std::vector<std::shared_ptr<const Species>> m_species;
         Eigen::MatrixXf m_team_traits_matrix;
         std::vector<std::shared_ptr<MotionPlannerBase>> m_motion_planners;
+        std::size_t m_motion_planners_hash;
 
         ConfigurationType m_task_configuration_type;
         OmplStateSpaceType m_ompl_state_space_type;
@@ -220,6 +223,11 @@ namespace grstapse
         assert(index < m_motion_planners.size());
         return m_motion_planners[index];
     }
+
+    std::size_t GrstapsProblemInputs::motionPlannersHash() const
+    {
+        return m_motion_planners_hash;
+    }
 }  // namespace grstapse
 
 namespace nlohmann
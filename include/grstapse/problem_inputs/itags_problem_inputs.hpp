@@ -34,6 +34,7 @@
 // Local
 #include "grstapse/common/utilities/custom_views.hpp"
 #include "grstapse/problem_inputs/grstaps_problem_inputs.hpp"
+#include "grstapse/scheduling/precedence_closure.hpp"
 
 namespace grstapse
 {
@@ -107,6 +108,7 @@ namespace grstapse
         [[nodiscard]] const std::shared_ptr<const Task>& planTask(unsigned int index) const;
         [[nodiscard]] inline unsigned int numberOfPlanTasks() const;
         [[nodiscard]] inline const std::set<std::pair<unsigned int, unsigned int>>& precedenceConstraints() const;
+        [[nodiscard]] inline const PrecedenceClosure& precedenceClosure() const;
         [[nodiscard]] inline const Eigen::MatrixXf& desiredTraitsMatrix() const;
         [[nodiscard]] inline const Eigen::MatrixXf& linearCoefficientMatrix() const;
         [[nodiscard]] inline float scheduleBestMakespan() const;
@@ -136,18 +138,23 @@ namespace grstapse
         //// Motion Planners
         [[nodiscard]] inline const std::vector<std::shared_ptr<MotionPlannerBase>>& motionPlanners() const;
         [[nodiscard]] inline const std::shared_ptr<MotionPlannerBase>& motionPlanner(unsigned int index) const;
+        [[nodiscard]] inline std::size_t motionPlannersHash() const;
 
        protected:
         std::vector<std::shared_ptr<const Task>> loadTasks(
             const nlohmann::json& j,
             const std::shared_ptr<const GrstapsProblemInputs>& grstaps_problem_inputs);
 
+        //! Sets the transitive closure of \p precedence_constraints (both as a set and as a bitset closure)
+        void setPrecedenceConstraints(const std::set<std::pair<unsigned int, unsigned int>>& precedence_constraints);
+
         //! compute the values for m_schedule_best_makespan and m_schedule_worst_makespan
         void computeScheduleBestWorst();
 
         // From task planning
         std::vector<unsigned int> m_plan_task_indices;
         std::set<std::pair<unsigned int, unsigned int>> m_precedence_constraints;
+        PrecedenceClosure m_precedence_closure;
         Eigen::MatrixXf m_desired_traits_matrix;
         Eigen::MatrixXf m_linear_coefficient_matrix;
         float m_schedule_best_makespan;
@@ -170,6 +177,10 @@ namespace grstapse
     {
         return m_precedence_constraints;
     }
+    const PrecedenceClosure& ItagsProblemInputs::precedenceClosure() const
+    {
+        return m_precedence_closure;
+    }
     const Eigen::MatrixXf& ItagsProblemInputs::desiredTraitsMatrix() const
     {
         return m_desired_traits_matrix;
@@ -246,6 +257,10 @@ namespace grstapse
     {
         return m_grstaps_problem_inputs->motionPlanner(index);
     }
+    std::size_t ItagsProblemInputs::motionPlannersHash() const
+    {
+        return m_grstaps_problem_inputs->motionPlannersHash();
+    }
 }  // namespace grstapse
 
 namespace nlohmann
@@ -29,6 +29,7 @@
 #include <vector>
 // Local
 #include "grstapse/problem_inputs/itags_problem_inputs.hpp"
+#include "grstapse/scheduling/mutex_set.hpp"
 
 namespace grstapse
 {
@@ -56,6 +57,17 @@ namespace grstapse
         explicit SchedulerProblemInputs(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
                                         Eigen::MatrixXf&& allocation);
 
+        /*!
+         * \brief Constructor
+         *
+         * \param problem_inputs
+         * \param allocation
+         * \param mutex_set The mutex constraints for \p allocation (e.g. maintained incrementally by the search)
+         */
+        explicit SchedulerProblemInputs(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
+                                        const Eigen::MatrixXf& allocation,
+                                        const MutexSet& mutex_set);
+
         /*!
          * Throws an exception if the output from task planning isn't valid
          *
@@ -85,7 +97,7 @@ namespace grstapse
 
         // Output from Task Allocation
         [[nodiscard]] inline const Eigen::MatrixXf& allocation() const;
-        [[nodiscard]] virtual inline const std::set<std::pair<unsigned int, unsigned int>>& mutexConstraints() const;
+        [[nodiscard]] inline const MutexSet& mutexSet() const;
         [[nodiscard]] inline float scheduleBestMakespan() const;
         [[nodiscard]] inline float scheduleWorstMakespan() const;
 
@@ -95,6 +107,7 @@ namespace grstapse
         [[nodiscard]] inline unsigned int numberOfPlanTasks() const;
         [[nodiscard]] virtual inline const std::set<std::pair<unsigned int, unsigned int>>& precedenceConstraints()
             const;
+        [[nodiscard]] inline const PrecedenceClosure& precedenceClosure() const;
 
         // Module Parameters
         [[nodiscard]] inline const std::shared_ptr<const ParametersBase>& schedulerParameters() const;
@@ -115,8 +128,8 @@ namespace grstapse
 
        protected:
         // From task allocation (order matters)
-        std::set<std::pair<unsigned int, unsigned int>> m_mutex_constraints;  //!< Must be before m_allocation
-        Eigen::MatrixXf m_allocation;                                         //!< Must be after m_mutex_constraints
+        MutexSet m_mutex_set;          //!< Must be before m_allocation
+        Eigen::MatrixXf m_allocation;  //!< Must be after m_mutex_set
         // todo deadlines?
 
         std::shared_ptr<const ItagsProblemInputs> m_itags_problem_inputs;
@@ -129,9 +142,9 @@ namespace grstapse
     {
         return m_allocation;
     }
-    const std::set<std::pair<unsigned int, unsigned int>>& SchedulerProblemInputs::mutexConstraints() const
+    const MutexSet& SchedulerProblemInputs::mutexSet() const
     {
-        return m_mutex_constraints;
+        return m_mutex_set;
     }
     const std::shared_ptr<const ItagsProblemInputs>& SchedulerProblemInputs::itagsProblemInputs() const
     {
@@ -153,6 +166,10 @@ namespace grstapse
     {
         return m_itags_problem_inputs->precedenceConstraints();
     }
+    const PrecedenceClosure& SchedulerProblemInputs::precedenceClosure() const
+    {
+        return m_itags_problem_inputs->precedenceClosure();
+    }
     const std::shared_ptr<const ParametersBase>& SchedulerProblemInputs::schedulerParameters() const
     {
         return m_itags_problem_inputs->schedulerParameters();
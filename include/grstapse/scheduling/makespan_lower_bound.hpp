@@ -0,0 +1,57 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// External
+#include <Eigen/Core>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ItagsProblemInputs;
+    class SchedulerProblemInputs;
+    class SchedulerMotionPlannerInterfaceBase;
+
+    /*!
+     * \brief Computes a lower bound on the makespan of any schedule for an allocation without building a MILP
+     *
+     * The bound is the maximum of:
+     * - The longest path through the precedence constraints using estimated task and transition durations
+     * - For each robot, the time needed to perform all of its tasks one after another (the mutex constraints)
+     *
+     * Durations are estimated from straight-line distances, so no motion planning is done.
+     *
+     * \param problem_inputs The inputs for the problem
+     * \param allocation The allocation of robots to tasks
+     * \param motion_planner_interface Provides the duration estimates
+     *
+     * \returns A lower bound on the makespan (infinity if the precedence constraints contain a cycle)
+     */
+    [[nodiscard]] float computeMakespanLowerBound(const ItagsProblemInputs& problem_inputs,
+                                                  const Eigen::MatrixXf& allocation,
+                                                  const SchedulerMotionPlannerInterfaceBase& motion_planner_interface);
+
+    //! \copydoc computeMakespanLowerBound
+    [[nodiscard]] float computeMakespanLowerBound(const SchedulerProblemInputs& problem_inputs,
+                                                  const SchedulerMotionPlannerInterfaceBase& motion_planner_interface);
+}  // namespace grstapse
\ No newline at end of file
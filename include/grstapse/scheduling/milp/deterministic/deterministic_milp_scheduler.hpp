@@ -28,9 +28,8 @@
 #include <memory>
 #include <tuple>
 #include <unordered_map>
-// External
-#include <gurobi_c++.h>
 // Local
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/scheduling/milp/deterministic/deterministic_milp_scheduler_base.hpp"
 // endregion
 
@@ -24,6 +24,7 @@
 
 // Local
 #include "grstapse/scheduling/milp/deterministic/deterministic_milp_scheduler_base.hpp"
+#include "grstapse/scheduling/milp/deterministic/longest_path_evaluator.hpp"
 
 namespace grstapse
 {
@@ -93,6 +94,65 @@ namespace grstapse
         //! \returns The minimum makespan based solely on precedence transitions, task duration, and initial transitions
         [[nodiscard]] double longestFixedChain() const;
 
+        /*!
+         * \brief Computes the makespan of this scenario without building a MILP model
+         *
+         * \param mutex_orderings The ordering (predecessor, successor) chosen for each mutex constraint
+         *
+         * \returns The makespan and the critical chain of tasks that determines it
+         *
+         * \note Only requires setupData to have been run
+         */
+        [[nodiscard]] LongestPathResult longestPath(
+            const std::vector<std::pair<unsigned int, unsigned int>>& mutex_orderings) const;
+
+        /*!
+         * \brief Creates the optimality cut that corresponds to a critical chain
+         *
+         * The dual of the longest path LP places a value of one on the lower bound constraint of the first task,
+         * each transition constraint along the chain, and the makespan constraint of the last task.
+         *
+         * \tparam ReturnType float, double, or GRBLinExpr
+         * \tparam Variable float, double, or GRBVar
+         *
+         * \param longest_path The result of longestPath
+         * \param master_mutex_indicators A map of the mutex indicators from the master problem
+         *
+         * \returns The optimality cut generated by the critical chain
+         */
+        template <DualCutReturnType ReturnType, DualCutVariableType Variable>
+        [[nodiscard]] ReturnType criticalPathCut(
+            const LongestPathResult& longest_path,
+            std::unordered_map<std::pair<unsigned int, unsigned int>, Variable>& master_mutex_indicators) const
+        {
+            const std::vector<unsigned int>& chain = longest_path.critical_chain;
+            if(chain.empty())
+            {
+                return ReturnType(longest_path.makespan);
+            }
+
+            const double M = getM();
+            ReturnType rv  = m_task_info.taskLowerBound(chain.front()) + m_task_info.taskDuration(chain.back());
+            for(unsigned int k = 1; k < chain.size(); ++k)
+            {
+                const unsigned int predecessor = chain[k - 1];
+                const unsigned int successor   = chain[k];
+                rv += m_task_info.taskDuration(predecessor) +
+                      m_transition_info.transitionDurationLowerBound(predecessor, successor);
+                if(auto iter = master_mutex_indicators.find({predecessor, successor});
+                   iter != master_mutex_indicators.end())
+                {
+                    rv -= M * (1.0 - iter->second);
+                }
+                else if(iter = master_mutex_indicators.find({successor, predecessor});
+                        iter != master_mutex_indicators.end())
+                {
+                    rv -= M * iter->second;
+                }
+            }
+            return rv;
+        }
+
        protected:
         //! \copydoc MilpSolverBase
         [[nodiscard]] std::shared_ptr<const FailureReason> createObjective(GRBModel& model) final override;
@@ -114,6 +174,7 @@ namespace grstapse
 
         friend class StochasticMilpSchedulerBase;
         friend class StochasticMilpScheduler;
+        friend class BendersParallelStochasticMilpScheduler;
         friend class BendersStochasticLpSubscheduler;
         friend class HeuristicApproximationStochasticScheduler;
     };
@@ -24,9 +24,8 @@
 
 // Global
 #include <memory>
-// External
-#include "gurobi_c++.h"
 // Local
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/scheduling/milp/deterministic/dms_task_info.hpp"
 
 namespace grstapse
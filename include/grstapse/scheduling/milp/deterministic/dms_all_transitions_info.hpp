@@ -30,9 +30,9 @@
 #include <unordered_set>
 #include <vector>
 // External
-#include <gurobi_c++.h>
 #include <range/v3/view/transform.hpp>
 // Local
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/common/utilities/hash_extension.hpp"
 #include "grstapse/common/utilities/update_model_result.hpp"
 #include "grstapse/scheduling/milp/deterministic/dms_all_tasks_info.hpp"
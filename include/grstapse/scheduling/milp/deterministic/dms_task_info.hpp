@@ -25,9 +25,8 @@
 // Global
 #include <memory>
 #include <unordered_map>
-// External
-#include <gurobi_c++.h>
 // Local
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/common/utilities/custom_views.hpp"
 #include "grstapse/common/utilities/update_model_result.hpp"
 #include "grstapse/scheduling/milp/deterministic/transition_computation_status.hpp"
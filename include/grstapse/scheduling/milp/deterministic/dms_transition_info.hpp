@@ -27,11 +27,11 @@
 #include <tuple>
 #include <vector>
 // External
-#include <gurobi_c++.h>
 #include <robin_hood/robin_hood.hpp>
 // Local
 #include <fmt/format.h>
 
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/common/milp/milp_utilties.hpp"
 #include "grstapse/common/utilities/custom_views.hpp"
 #include "grstapse/common/utilities/update_model_result.hpp"
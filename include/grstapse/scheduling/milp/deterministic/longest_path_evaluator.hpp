@@ -0,0 +1,78 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <utility>
+#include <vector>
+
+namespace grstapse
+{
+    //! The result of evaluating the longest path through a set of tasks
+    struct LongestPathResult
+    {
+        float makespan;                            //!< Infinity if the precedence graph has a cycle
+        std::vector<unsigned int> critical_chain;  //!< The tasks (in order) on a path that determines the makespan
+    };
+
+    /*!
+     * \brief Computes the makespan of a deterministic scheduling problem where all the orderings are fixed
+     *
+     * Once every mutex constraint has been assigned an ordering, the scheduling LP reduces to finding the longest path
+     * through a DAG of tasks, which is solved in O(V+E) with a topological sort.
+     *
+     * \see DeterministicMilpSubscheduler
+     */
+    class LongestPathEvaluator
+    {
+       public:
+        //! Constructor
+        explicit LongestPathEvaluator(unsigned int num_tasks);
+
+        /*!
+         * \brief Sets the timing information for a task
+         *
+         * \param task_nr The index of the task
+         * \param lower_bound The earliest the task can start (e.g. the longest initial transition)
+         * \param duration The duration of the task
+         */
+        void setTask(unsigned int task_nr, float lower_bound, float duration);
+
+        /*!
+         * \brief Adds an ordering between two tasks
+         *
+         * \param predecessor The index of the task that must finish first
+         * \param successor The index of the task that starts after
+         * \param transition_duration The time needed to transition between the two tasks
+         */
+        void addEdge(unsigned int predecessor, unsigned int successor, float transition_duration);
+
+        //! \returns The makespan and a critical chain of tasks
+        [[nodiscard]] LongestPathResult evaluate() const;
+
+       private:
+        std::vector<float> m_lower_bounds;
+        std::vector<float> m_durations;
+        std::vector<std::vector<std::pair<unsigned int, float>>> m_successors;
+    };
+}  // namespace grstapse
\ No newline at end of file
@@ -56,9 +56,12 @@ namespace grstapse
         MilpSchedulerBase& operator=(MilpSchedulerBase&&) noexcept = default;
         // endregion
 
-        //! \returns The number of times a MILP optimization was run
+        //! \returns The number of times a MILP optimization was run (in the active Metrics)
         [[nodiscard]] static unsigned int numIterations();
 
+        //! \copydoc SchedulerBase::setDeadline
+        void setDeadline(const std::shared_ptr<const Deadline>& deadline) override;
+
        protected:
         //! Constructor
         explicit MilpSchedulerBase(const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
@@ -133,13 +136,22 @@ namespace grstapse
         //! Builds a schedule from the MILP variables in \p model
         virtual std::shared_ptr<const ScheduleBase> createSchedule(GRBModel& model) = 0;
 
+        /*!
+         * \brief Uses the mutex orderings of the warm start schedule as a (partial) MIP start
+         *
+         * Mutex indicators that do not exist in the warm start schedule are left undefined for the solver to complete
+         *
+         * \see SchedulerBase::setWarmStart
+         */
+        void setStartValues(GRBModel& model) override;
+
         /*!
          * \returns Big M
          * \see https://en.wikipedia.org/wiki/Big_M_method
          */
         [[nodiscard]] double getM() const;
 
-        static unsigned int s_num_iterations;
+        static const MetricId s_num_iterations_id;
         //! These are the mutex constraint ids after the precedence constraints have been removed
         std::shared_ptr<MutexIndicators> m_mutex_indicators;
     };
@@ -26,16 +26,18 @@
 #include <set>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 // External
 #include <Eigen/Core>
-#include <gurobi_c++.h>
 // Local
+#include "grstapse/common/milp/milp_backend.hpp"
 #include "grstapse/common/utilities/hash_extension.hpp"
 
 namespace grstapse
 {
     // Forward Declarations
     class MsNameSchemeBase;
+    class PrecedenceClosure;
     class SchedulerProblemInputs;
 
     /*!
@@ -48,12 +50,23 @@ namespace grstapse
          * \brief Constructor
          *
          * \param mutex_constraints A set of mutex constraints on the tasks
-         * \param precedence_constraints A set of precedence constraints on the tasks
+         * \param precedence_closure The transitive closure of the precedence constraints on the tasks
          * \param master true if these mutex indicators are part of a master or monolithic problem, false if part of a
          *               subproblem (Default: true)
          */
         MutexIndicators(const std::set<std::pair<unsigned int, unsigned int>>& mutex_constraints,
-                        const std::set<std::pair<unsigned int, unsigned int>>& precedence_constraints,
+                        const PrecedenceClosure& precedence_closure,
+                        const std::shared_ptr<const MsNameSchemeBase>& name_scheme,
+                        bool master = true);
+
+        /*!
+         * \brief Constructor
+         *
+         * \param unordered_mutex_constraints Mutex constraints that are not already ordered by a precedence constraint
+         * \param master true if these mutex indicators are part of a master or monolithic problem, false if part of a
+         *               subproblem (Default: true)
+         */
+        MutexIndicators(const std::vector<std::pair<unsigned int, unsigned int>>& unordered_mutex_constraints,
                         const std::shared_ptr<const MsNameSchemeBase>& name_scheme,
                         bool master = true);
 
@@ -77,7 +90,6 @@ namespace grstapse
         [[nodiscard]] std::vector<std::pair<unsigned int, unsigned int>> precedenceSet() const;
 
        private:
-        const std::set<std::pair<unsigned int, unsigned int>>& m_precedence_constraints;
         std::shared_ptr<const MsNameSchemeBase> m_name_scheme;
         std::unordered_map<std::pair<unsigned int, unsigned int>, GRBVar> m_indicators;
         bool m_master;
@@ -0,0 +1,91 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <deque>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class MutexSet;
+    class PrecedenceClosure;
+
+    /*!
+     * \brief Pool of the critical chains behind Benders optimality cuts that is shared by the schedulers of different
+     *        ITAGS nodes
+     *
+     * A critical chain cut bounds the makespan of a scenario by the length of a chain of tasks, so it stays valid for
+     * any allocation in which every consecutive pair of tasks on the chain is still ordered by a precedence
+     * constraint or a mutex indicator. Only the chains are pooled; the cut itself is rebuilt from the durations of the
+     * scheduler it is injected into.
+     *
+     * \note Thread safe
+     */
+    class BendersCutPool
+    {
+       public:
+        /*!
+         * \brief Constructor
+         *
+         * \param max_chains_per_scenario The number of chains kept for each scenario (the oldest are evicted first)
+         */
+        explicit BendersCutPool(unsigned int max_chains_per_scenario = 256);
+
+        //! \brief Adds the critical \p chain of \p scenario to the pool (duplicates are ignored)
+        void add(unsigned int scenario, const std::vector<unsigned int>& chain);
+
+        /*!
+         * \returns The chains for \p scenario whose edges all exist in a problem with \p precedence_closure and
+         *          \p mutex_set
+         */
+        [[nodiscard]] std::vector<std::vector<unsigned int>> validChains(unsigned int scenario,
+                                                                         const PrecedenceClosure& precedence_closure,
+                                                                         const MutexSet& mutex_set) const;
+
+        /*!
+         * \returns Whether each consecutive pair (i, j) on \p chain is either ordered i before j by
+         *          \p precedence_closure or is a mutex constraint that \p precedence_closure does not order j before i
+         */
+        [[nodiscard]] static bool isValid(const std::vector<unsigned int>& chain,
+                                          const PrecedenceClosure& precedence_closure,
+                                          const MutexSet& mutex_set);
+
+        //! \returns The total number of chains in the pool
+        [[nodiscard]] unsigned int size() const;
+
+       private:
+        struct ScenarioChains
+        {
+            std::deque<std::vector<unsigned int>> chains;  //!< In insertion order for eviction
+            std::set<std::vector<unsigned int>> contained;
+        };
+
+        unsigned int m_max_chains_per_scenario;
+        std::vector<ScenarioChains> m_scenarios;
+        mutable std::mutex m_mutex;
+    };
+}  // namespace grstapse
\ No newline at end of file
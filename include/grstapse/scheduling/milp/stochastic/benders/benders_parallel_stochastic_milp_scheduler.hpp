@@ -40,7 +40,8 @@ namespace grstapse
         //! Constructor
         explicit BendersParallelStochasticMilpScheduler(
             const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
-            const std::shared_ptr<const SmsNameSchemeBase>& name_scheme = std::make_shared<SmsNameSchemeCommon>());
+            const std::shared_ptr<const SmsNameSchemeBase>& name_scheme = std::make_shared<SmsNameSchemeCommon>(),
+            const std::shared_ptr<BendersCutPool>& cut_pool             = nullptr);
 
        protected:
         //! \copydoc MilpSolverBase
@@ -55,6 +56,7 @@ namespace grstapse
         std::unordered_map<std::pair<unsigned int, unsigned int>, bool> m_mutex_indicator_values;
         std::vector<bool> m_y_indicator_values;
         std::vector<float> m_subproblem_makespans;
+        std::vector<LongestPathResult> m_critical_paths;
         std::vector<std::shared_ptr<MutexIndicators>> m_subproblem_mutex_indicators;
         std::vector<std::unique_ptr<DeterministicMilpSubscheduler>> m_subschedulers;
     };
@@ -40,7 +40,8 @@ namespace grstapse
         //! Constructor
         explicit BendersStochasticMilpScheduler(
             const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
-            const std::shared_ptr<const SmsNameSchemeBase>& name_scheme = std::make_shared<SmsNameSchemeCommon>());
+            const std::shared_ptr<const SmsNameSchemeBase>& name_scheme = std::make_shared<SmsNameSchemeCommon>(),
+            const std::shared_ptr<BendersCutPool>& cut_pool             = nullptr);
 
        protected:
         //! \copydoc MilpSolverBase
@@ -28,6 +28,10 @@
 
 namespace grstapse
 {
+    // Forward Declarations
+    class BendersCutPool;
+    class DeterministicMilpSubscheduler;
+
     /*!
      * \brief Base class for using bender's decomposition for stochastic robot scheduling
      *
@@ -38,10 +42,17 @@ namespace grstapse
     class [[deprecated]] BendersStochasticMilpSchedulerBase : public MilpSchedulerBase
     {
        public:
-        //! Constructor
+        /*!
+         * \brief Constructor
+         *
+         * \param problem_inputs
+         * \param name_scheme
+         * \param cut_pool Critical chains shared with the schedulers of other allocations (optional)
+         */
         explicit BendersStochasticMilpSchedulerBase(
             const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
-            const std::shared_ptr<const SmsNameSchemeBase>& name_scheme = std::make_shared<SmsNameSchemeCommon>());
+            const std::shared_ptr<const SmsNameSchemeBase>& name_scheme = std::make_shared<SmsNameSchemeCommon>(),
+            const std::shared_ptr<BendersCutPool>& cut_pool             = nullptr);
 
        protected:
         //! \copydoc MilpSchedulerBase
@@ -68,6 +79,16 @@ namespace grstapse
          */
         virtual std::shared_ptr<const FailureReason> createInitialCuts(GRBModel& model) = 0;
 
+        /*!
+         * \brief Adds a critical chain cut for each chain in the cut pool that is still valid for this problem
+         *
+         * \param model The model to add the cuts to
+         * \param subschedulers The subscheduler for each scenario (used to rebuild the cuts with this problem's
+         *                      durations)
+         */
+        void createPooledCuts(GRBModel& model,
+                              const std::vector<std::unique_ptr<DeterministicMilpSubscheduler>>& subschedulers);
+
         //! \copydoc MilpSchedulerBase
         std::shared_ptr<const ScheduleBase> createSchedule(GRBModel& model) override;
 
@@ -77,6 +98,7 @@ namespace grstapse
         std::vector<GRBVar> m_task_stubs;
         std::vector<GRBVar> m_master_y_indicators;
         std::shared_ptr<const SmsNameSchemeBase> m_name_scheme;
+        std::shared_ptr<BendersCutPool> m_cut_pool;
     };
 
 }  // namespace grstapse
\ No newline at end of file
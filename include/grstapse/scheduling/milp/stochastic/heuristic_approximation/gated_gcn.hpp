@@ -0,0 +1,141 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+// External
+#include <Eigen/Core>
+#include <nlohmann/json.hpp>
+
+namespace grstapse
+{
+    /*!
+     * \brief CPU inference for the residual gated graph convnet (GatedGCNNet in python/embed/gnn_scenario_selector.py)
+     *
+     * The weights are exported from a trained model with 'export_gnn' in python/embed/gnn_scenario_selector.py. The
+     * model is evaluated in inference mode (dropout is the identity and batch normalization uses the running
+     * statistics), so the batch normalization is folded into a scale and shift when loading.
+     *
+     * \see Bresson & Laurent, Residual Gated Graph ConvNets, 2018
+     */
+    class GatedGcn
+    {
+       public:
+        //! Row major so that the rows of nodes and edges are contiguous when gathered and scattered
+        using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+        //! \brief Constructor from the json created by 'export_gnn'
+        explicit GatedGcn(const nlohmann::json& j);
+
+        //! \returns The model stored in the json file at \p filepath
+        [[nodiscard]] static GatedGcn load(const std::string& filepath);
+
+        /*!
+         * \brief Scores a batch of graphs that share the same nodes and edges (but not features) in a single pass
+         *
+         * \param num_nodes The number of nodes in each graph
+         * \param edges The (source, destination) of each edge in each graph
+         * \param node_features One row per node, grouped by graph
+         * \param edge_features One row per edge, grouped by graph (in the order of \p edges)
+         * \param alpha The robustness value appended to the readout of each graph
+         *
+         * \returns The probability that each graph should be selected
+         */
+        [[nodiscard]] std::vector<float> predict(unsigned int num_nodes,
+                                                 std::span<const std::pair<unsigned int, unsigned int>> edges,
+                                                 const Matrix& node_features,
+                                                 const Matrix& edge_features,
+                                                 float alpha) const;
+
+        //! \returns The dimension of the hidden node and edge features
+        [[nodiscard]] inline unsigned int hiddenDimension() const;
+
+        //! \returns The number of gated graph convolution layers
+        [[nodiscard]] inline unsigned int numberOfLayers() const;
+
+       private:
+        //! A fully connected layer (y = x * W^T + b)
+        struct Linear
+        {
+            Matrix weight;
+            Eigen::RowVectorXf bias;
+
+            [[nodiscard]] Matrix operator()(const Matrix& x) const;
+        };
+
+        //! Batch normalization in inference mode folded into y = x * scale + shift
+        struct BatchNorm
+        {
+            Eigen::RowVectorXf scale;
+            Eigen::RowVectorXf shift;
+
+            void operator()(Matrix& x) const;
+        };
+
+        //! A gated graph convolution layer
+        struct Layer
+        {
+            Linear node_self;         //!< A
+            Linear node_neighbor;     //!< B
+            Linear edge_self;         //!< C
+            Linear edge_source;       //!< D
+            Linear edge_destination;  //!< E
+            BatchNorm node_batch_norm;
+            BatchNorm edge_batch_norm;
+        };
+
+        enum class Readout : uint8_t
+        {
+            e_sum,
+            e_max,
+            e_mean
+        };
+
+        [[nodiscard]] static Linear linearFromJson(const nlohmann::json& j);
+        [[nodiscard]] static BatchNorm batchNormFromJson(const nlohmann::json& j);
+
+        Linear m_node_embedding;
+        Linear m_edge_embedding;
+        std::vector<Layer> m_layers;
+        std::vector<Linear> m_readout_layers;  //!< A ReLU is applied after each but the last
+        Readout m_readout;
+        bool m_batch_norm;
+        bool m_residual;
+        bool m_use_edge_features;
+    };
+
+    // Inline functions
+    unsigned int GatedGcn::hiddenDimension() const
+    {
+        return m_node_embedding.weight.rows();
+    }
+
+    unsigned int GatedGcn::numberOfLayers() const
+    {
+        return m_layers.size();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -24,7 +24,7 @@
 
 // region Includes
 // Global
-#include <tuple>
+#include <random>
 #include <vector>
 // External
 // Local
@@ -35,7 +35,7 @@ namespace grstapse
 {
     // region Forward Declarations
     class SchedulerProblemInputs;
-    class EuclideanGraphEnvironment;
+    class SampledEuclideanGraphEnvironment;
     // endregion
 
     /*!
@@ -70,12 +70,19 @@ namespace grstapse
             float gamma,
             float timeout) override;
 
+       protected:
+        /*!
+         * \returns The label (static durations plus the travel time of each task) of the first \p num_samples graphs
+         *          in \p environment
+         *
+         * \note The edge costs are gathered into a (edges x scenarios) matrix in parallel and the labels are reduced
+         *       over it in blocks of scenarios, so the inner loop is vectorized
+         */
+        [[nodiscard]] std::vector<float> labels(const SampledEuclideanGraphEnvironment& environment,
+                                                unsigned int num_samples) const;
+
        private:
-        [[nodiscard]] float label(const std::shared_ptr<EuclideanGraphEnvironment>& environment,
-                                  std::vector<std::pair<unsigned int, unsigned int>> task_edges,
-                                  std::vector<std::pair<unsigned int, unsigned int>> precedence_transition_edges,
-                                  std::vector<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>>
-                                      mutex_transition_edges) const;
+        std::mt19937 m_random_engine;  //!< Seeded with 'seed' if it is set
 
     };  // class HeuristicScenarioSelector
 }  // namespace grstapse
\ No newline at end of file
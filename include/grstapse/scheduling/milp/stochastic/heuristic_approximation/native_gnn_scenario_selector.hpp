@@ -0,0 +1,86 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// region Includes
+// Global
+#include <utility>
+#include <vector>
+// Local
+#include "grstapse/scheduling/milp/stochastic/heuristic_approximation/gated_gcn.hpp"
+#include "grstapse/scheduling/milp/stochastic/heuristic_approximation/scenario_selector_base.hpp"
+// endregion
+
+namespace grstapse
+{
+    /*!
+     * \class NativeGnnScenarioSelector
+     * \brief Selects the scenarios with the highest GNN scores without embedding python
+     *
+     * Same model and graph features as GnnScenarioSelector, but the weights are exported with 'export_gnn' (see
+     * python/embed/gnn_scenario_selector.py) and every scenario is scored by GatedGcn in a single batched pass
+     */
+    class NativeGnnScenarioSelector : public ScenarioSelectorBase
+    {
+       public:
+        // region Special Member Functions
+        //! Default Constructor
+        NativeGnnScenarioSelector() = delete;
+        //! Copy Constructor
+        NativeGnnScenarioSelector(const NativeGnnScenarioSelector&) = default;
+        //! Move Constructor
+        NativeGnnScenarioSelector(NativeGnnScenarioSelector&&) noexcept = default;
+        //! Destructor
+        ~NativeGnnScenarioSelector() = default;
+        //! Copy Assignment Operator
+        NativeGnnScenarioSelector& operator=(const NativeGnnScenarioSelector&) = default;
+        //! Move Assignment Operator
+        NativeGnnScenarioSelector& operator=(NativeGnnScenarioSelector&&) noexcept = default;
+        // endregion
+
+        explicit NativeGnnScenarioSelector(const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs);
+
+        [[nodiscard]] std::optional<std::vector<bool>> createMask(
+            Timer& timer,
+            const std::shared_ptr<MaskedCompleteSampledEuclideanGraphMotionPlanner>& motion_planner,
+            unsigned int num_samples,
+            unsigned int beta,
+            float gamma,
+            float timeout) override;
+
+       private:
+        /*!
+         * \brief Computes the node (task lower bound) and edge (type, duration + transition) features of each scenario
+         *
+         * \note Each scenario only queries its own sampled graph, so the scenarios are computed in parallel
+         */
+        void computeFeatures(unsigned int num_samples,
+                             GatedGcn::Matrix& node_features,
+                             GatedGcn::Matrix& edge_features) const;
+
+        std::shared_ptr<const GatedGcn> m_model;  //!< Shared by every selector that uses the same weights file
+        //! The precedence edges followed by both directions of each mutex constraint that is not ordered
+        std::vector<std::pair<unsigned int, unsigned int>> m_edges;
+        unsigned int m_num_precedence_edges;
+    };  // class NativeGnnScenarioSelector
+}  // namespace grstapse
\ No newline at end of file
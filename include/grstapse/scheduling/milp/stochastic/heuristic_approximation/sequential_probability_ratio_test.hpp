@@ -23,6 +23,9 @@
 #pragma once
 
 // region Includes
+// Global
+#include <optional>
+#include <span>
 // External
 #include <cppcoro/generator.hpp>
 // endregion
@@ -79,7 +82,35 @@ namespace grstapse
                                unsigned int max_num_samples,
                                cppcoro::generator<float> samples) const;
 
+        /*!
+         * Runs the test on samples that have already been computed
+         *
+         * \param reference_value The makespan computed by the approximation MILP
+         * \param samples The makespans for the elements of the G set (in the order they should be inspected)
+         */
+        [[nodiscard]] bool run(float reference_value, std::span<const float> samples) const;
+
+        /*!
+         * \brief Finds the smallest reference value (no smaller than \p lower_bound) that the test accepts
+         *
+         * A sample is only bad while it is greater than the reference value, so raising the reference value can only
+         * turn bad samples good and the test accepts every reference value above one it accepts. The outcome also only
+         * changes at the value of a sample. So a binary search over the sorted sample values finds the smallest
+         * accepted reference value with O(log n) passes over the cached samples.
+         *
+         * \param lower_bound The smallest reference value to consider (e.g. the makespan computed by the approximation
+         *                    MILP)
+         * \param samples The makespans for the elements of the G set (in the order they should be inspected)
+         *
+         * \returns The smallest accepted reference value, or std::nullopt if the test does not accept any finite value
+         */
+        [[nodiscard]] std::optional<float> minimumAcceptedReference(float lower_bound,
+                                                                    std::span<const float> samples) const;
+
        private:
+        //! \returns A generator that yields each of \p samples
+        [[nodiscard]] static cppcoro::generator<float> yieldSamples(std::span<const float> samples);
+
         //! \returns
         [[nodiscard]] float getAcceptanceNumber(float inspected_samples) const;
 
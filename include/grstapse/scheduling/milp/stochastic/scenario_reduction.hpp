@@ -0,0 +1,67 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <span>
+#include <vector>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class SampledEuclideanGraphEnvironment;
+    class SchedulerProblemInputs;
+
+    //! A small weighted set of scenarios that represents a larger set of equally likely scenarios
+    struct ReducedScenarios
+    {
+        std::vector<unsigned int> indices;  //!< Indices of the selected scenarios (ascending)
+        std::vector<float> weights;         //!< Probability of each selected scenario (sums to one)
+    };
+
+    /*!
+     * \returns The travel durations that each graph in \p graph_indices induces on the tasks and transitions
+     *          (precedence and mutex) of the allocation in \p problem_inputs, one row per graph
+     *
+     * \note The sampled graphs are complete, so each duration is the cost of the edge between the two configurations
+     *       divided by the speed of the slowest robot traversing it
+     */
+    [[nodiscard]] std::vector<std::vector<float>> scenarioDurationVectors(
+        const SchedulerProblemInputs& problem_inputs,
+        const SampledEuclideanGraphEnvironment& environment,
+        std::span<const unsigned int> graph_indices);
+
+    /*!
+     * \brief Reduces a set of equally likely \p scenarios to \p num_selected scenarios using fast forward selection
+     *        (Heitsch & Römisch) with the L1 distance
+     *
+     * The probability of each scenario that is not selected is reassigned to its closest selected scenario
+     *
+     * \param scenarios The duration vector of each scenario
+     * \param num_selected The number of scenarios to keep
+     * \param required Indices of scenarios that are always selected
+     */
+    [[nodiscard]] ReducedScenarios reduceScenarios(const std::vector<std::vector<float>>& scenarios,
+                                                   unsigned int num_selected,
+                                                   std::span<const unsigned int> required = {});
+}  // namespace grstapse
\ No newline at end of file
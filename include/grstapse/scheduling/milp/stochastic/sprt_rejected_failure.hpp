@@ -0,0 +1,37 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Local
+#include "grstapse/common/utilities/failure_reason.hpp"
+
+namespace grstapse
+{
+    /*!
+     * \brief The sequential probability ratio test did not accept any robust makespan for a stochastic schedule
+     *
+     * \see SequentialProbabilityRatioTest
+     */
+    struct SprtRejectedFailure : public FailureReason
+    {};
+}  // namespace grstapse
\ No newline at end of file
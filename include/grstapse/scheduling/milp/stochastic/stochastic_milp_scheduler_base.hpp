@@ -99,8 +99,34 @@ namespace grstapse
 
         [[nodiscard]] virtual unsigned int numFScenarios() const = 0;
 
+        /*!
+         * \brief Reduces the F set to 'num_reduced_scenarios' representative scenarios (if set) and masks the motion
+         *        planner to them
+         *
+         * Scenarios are clustered by the durations they induce on the tasks and transitions, so the MILP only contains
+         * one subscheduler (and y indicator) per cluster
+         */
+        [[nodiscard]] std::shared_ptr<const FailureReason> createReducedMask(Timer& timer, float timeout);
+
+        //! \returns The number of F set scenarios that scenario \p q represents in the chance constraint
+        [[nodiscard]] inline float scenarioMultiplicity(unsigned int q) const;
+
+        /*!
+         * \brief Yields the makespans of the G set scenarios in order
+         *
+         * Samples that have not been computed yet are computed in parallel batches (one per thread) and stored in
+         * m_prior_sprt, so any surplus from the last batch is reused when the SPRT is rerun with a larger makespan
+         */
         [[nodiscard]] cppcoro::generator<float> sprtSample(unsigned int num_g);
 
+        /*!
+         * \brief Computes the samples in [\p begin, \p end) that are not already stored in m_prior_sprt
+         *
+         * \note Each sample uses its own subscheduler, so they are computed concurrently
+         */
+        void sampleBatch(unsigned int begin, unsigned int end);
+
+        //! \returns The makespan of the G set scenario \p index under the current mutex constraints
         [[nodiscard]] float singleSample(unsigned int index);
 
         GRBVar m_makespan;
@@ -112,6 +138,13 @@ namespace grstapse
         std::vector<std::pair<unsigned int, unsigned int>> m_precedence_set_mutex_constraints;
         std::vector<float> m_prior_sprt;
         std::shared_ptr<MaskedCompleteSampledEuclideanGraphMotionPlanner> m_motion_planner;
+        std::vector<float> m_scenario_multiplicities;  //!< Empty unless the F set has been reduced
     };
 
+    // Inline functions
+    float StochasticMilpSchedulerBase::scenarioMultiplicity(unsigned int q) const
+    {
+        return m_scenario_multiplicities.empty() ? 1.0f : m_scenario_multiplicities[q];
+    }
+
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <set>
+#include <span>
+#include <utility>
+#include <vector>
+// External
+#include <Eigen/Core>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class PrecedenceClosure;
+
+    /*!
+     * \brief The mutex constraints of an allocation (pairs of tasks that share at least one robot)
+     *
+     * Stores the tasks allocated to each robot and the tasks that share a robot with each task as bitsets, so adding or
+     * removing a single assignment only touches the rows of that task and robot instead of rescanning the allocation
+     */
+    class MutexSet
+    {
+       public:
+        using Word = std::uint64_t;
+        static constexpr unsigned int k_bits_per_word = 64;
+
+        //! \brief Default Constructor (no tasks or robots)
+        MutexSet();
+
+        //! \brief Constructor for an empty allocation
+        MutexSet(unsigned int num_tasks, unsigned int num_robots);
+
+        //! \brief Constructor from a dense allocation matrix (non-zero elements are considered allocated)
+        explicit MutexSet(const Eigen::MatrixXf& allocation);
+
+        //! \brief Allocates \p robot to \p task
+        void add(unsigned int task, unsigned int robot);
+
+        //! \brief Removes \p robot from \p task
+        void remove(unsigned int task, unsigned int robot);
+
+        //! \returns Whether \p lhs and \p rhs share at least one robot
+        [[nodiscard]] inline bool contains(unsigned int lhs, unsigned int rhs) const;
+
+        //! \returns The words that store the tasks that share a robot with \p task
+        [[nodiscard]] inline std::span<const Word> taskWords(unsigned int task) const;
+
+        //! \returns The words that store the tasks allocated to \p robot
+        [[nodiscard]] inline std::span<const Word> robotWords(unsigned int robot) const;
+
+        //! \returns The number of tasks
+        [[nodiscard]] inline unsigned int numberOfTasks() const;
+
+        //! \returns The number of robots
+        [[nodiscard]] inline unsigned int numberOfRobots() const;
+
+        //! \returns The mutex constraints as a set of (i, j) pairs with i < j
+        [[nodiscard]] std::set<std::pair<unsigned int, unsigned int>> constraints() const;
+
+        /*!
+         * \returns The mutex constraints (i, j) with i < j that are not already ordered by \p precedence_closure
+         *
+         * \note Ordered pairs never need a mutex indicator as the precedence constraint already serializes them
+         */
+        [[nodiscard]] std::vector<std::pair<unsigned int, unsigned int>> unorderedConstraints(
+            const PrecedenceClosure& precedence_closure) const;
+
+       private:
+        [[nodiscard]] inline Word* taskRow(unsigned int task);
+        [[nodiscard]] inline Word* robotRow(unsigned int robot);
+
+        unsigned int m_num_tasks;
+        unsigned int m_num_robots;
+        unsigned int m_words_per_row;
+        std::vector<Word> m_task_words;   //!< Row i has bit j set if tasks i and j share a robot
+        std::vector<Word> m_robot_words;  //!< Row r has bit i set if robot r is allocated to task i
+    };
+
+    // Inline functions
+    bool MutexSet::contains(unsigned int lhs, unsigned int rhs) const
+    {
+        const Word& word = m_task_words[lhs * m_words_per_row + rhs / k_bits_per_word];
+        return (word >> (rhs % k_bits_per_word)) & Word{1};
+    }
+
+    std::span<const MutexSet::Word> MutexSet::taskWords(unsigned int task) const
+    {
+        return {m_task_words.data() + task * m_words_per_row, m_words_per_row};
+    }
+
+    std::span<const MutexSet::Word> MutexSet::robotWords(unsigned int robot) const
+    {
+        return {m_robot_words.data() + robot * m_words_per_row, m_words_per_row};
+    }
+
+    unsigned int MutexSet::numberOfTasks() const
+    {
+        return m_num_tasks;
+    }
+
+    unsigned int MutexSet::numberOfRobots() const
+    {
+        return m_num_robots;
+    }
+
+    MutexSet::Word* MutexSet::taskRow(unsigned int task)
+    {
+        return m_task_words.data() + task * m_words_per_row;
+    }
+
+    MutexSet::Word* MutexSet::robotRow(unsigned int robot)
+    {
+        return m_robot_words.data() + robot * m_words_per_row;
+    }
+}  // namespace grstapse
\ No newline at end of file
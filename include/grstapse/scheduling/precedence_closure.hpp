@@ -0,0 +1,121 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <set>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace grstapse
+{
+    /*!
+     * \brief The transitive closure of a set of precedence constraints stored as one bitset per task
+     *
+     * Row i has bit j set if task i must finish before task j starts (directly or transitively), so precedence queries
+     * are O(1) and the successors (or predecessors) of a task can be combined with other task bitsets a word at a time
+     */
+    class PrecedenceClosure
+    {
+       public:
+        using Word = std::uint64_t;
+        static constexpr unsigned int k_bits_per_word = 64;
+
+        //! \brief Default Constructor (no tasks)
+        PrecedenceClosure();
+
+        /*!
+         * \brief Constructor
+         *
+         * \param precedence_constraints (predecessor, successor) pairs
+         * \param num_tasks The number of tasks (at least one more than the largest index in \p precedence_constraints)
+         */
+        explicit PrecedenceClosure(const std::set<std::pair<unsigned int, unsigned int>>& precedence_constraints,
+                                   unsigned int num_tasks = 0);
+
+        //! \returns Whether \p predecessor must finish before \p successor starts
+        [[nodiscard]] inline bool precedes(unsigned int predecessor, unsigned int successor) const;
+
+        //! \returns Whether there is a precedence constraint between \p lhs and \p rhs in either direction
+        [[nodiscard]] inline bool ordered(unsigned int lhs, unsigned int rhs) const;
+
+        //! \returns The words that store the (transitive) successors of \p task
+        [[nodiscard]] inline std::span<const Word> successorWords(unsigned int task) const;
+
+        //! \returns The words that store the (transitive) predecessors of \p task
+        [[nodiscard]] inline std::span<const Word> predecessorWords(unsigned int task) const;
+
+        //! \returns The number of tasks
+        [[nodiscard]] inline unsigned int numberOfTasks() const;
+
+        //! \returns The number of words used to store a single task (row)
+        [[nodiscard]] inline unsigned int wordsPerTask() const;
+
+        //! \returns The closure as a set of (predecessor, successor) pairs
+        [[nodiscard]] std::set<std::pair<unsigned int, unsigned int>> constraints() const;
+
+       private:
+        unsigned int m_num_tasks;
+        unsigned int m_words_per_task;
+        std::vector<Word> m_words;
+        std::vector<Word> m_predecessor_words;  //!< Transpose of m_words
+    };
+
+    // Inline functions
+    bool PrecedenceClosure::precedes(unsigned int predecessor, unsigned int successor) const
+    {
+        if(predecessor >= m_num_tasks || successor >= m_num_tasks)
+        {
+            return false;
+        }
+        const Word& word = m_words[predecessor * m_words_per_task + successor / k_bits_per_word];
+        return (word >> (successor % k_bits_per_word)) & Word{1};
+    }
+
+    bool PrecedenceClosure::ordered(unsigned int lhs, unsigned int rhs) const
+    {
+        return precedes(lhs, rhs) || precedes(rhs, lhs);
+    }
+
+    std::span<const PrecedenceClosure::Word> PrecedenceClosure::successorWords(unsigned int task) const
+    {
+        return std::span<const Word>(m_words.data() + task * m_words_per_task, m_words_per_task);
+    }
+
+    std::span<const PrecedenceClosure::Word> PrecedenceClosure::predecessorWords(unsigned int task) const
+    {
+        return std::span<const Word>(m_predecessor_words.data() + task * m_words_per_task, m_words_per_task);
+    }
+
+    unsigned int PrecedenceClosure::numberOfTasks() const
+    {
+        return m_num_tasks;
+    }
+
+    unsigned int PrecedenceClosure::wordsPerTask() const
+    {
+        return m_words_per_task;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -28,6 +28,7 @@
 // External
 #include <nlohmann/json.hpp>
 // Local
+#include "grstapse/common/utilities/metrics.hpp"
 #include "grstapse/common/utilities/noncopyable.hpp"
 #include "grstapse/common/utilities/timer.hpp"
 // endregion
@@ -35,9 +36,11 @@
 namespace grstapse
 {
     // region Forward Declarations
+    class Deadline;
     class SchedulerProblemInputs;
     class SchedulerParameters;
     class SchedulerResult;
+    class ScheduleBase;
     // endregion
 
     //! \brief Abstract base class for a scheduling algorithm
@@ -60,7 +63,21 @@ namespace grstapse
          */
         [[nodiscard]] std::shared_ptr<const SchedulerResult> solve();
 
-        //! \returns The number of time that scheduling has failed
+        /*!
+         * \brief Provides the schedule of a closely related problem (e.g. the parent allocation in ITAGS)
+         *
+         * \note Schedulers that support it use this as a starting point; others ignore it
+         */
+        void setWarmStart(const std::shared_ptr<const ScheduleBase>& schedule);
+
+        /*!
+         * \brief Sets the deadline of the search that this scheduler is run from
+         *
+         * \note Schedulers that support it stop an in-flight solve once the deadline expires
+         */
+        virtual void setDeadline(const std::shared_ptr<const Deadline>& deadline);
+
+        //! \returns The number of time that scheduling has failed (in the active Metrics)
         [[nodiscard]] static unsigned int numFailures();
 
        protected:
@@ -80,8 +97,11 @@ namespace grstapse
         [[nodiscard]] virtual std::shared_ptr<const SchedulerResult> computeSchedule() = 0;
 
         std::shared_ptr<const SchedulerProblemInputs> m_problem_inputs;
+        std::shared_ptr<const ScheduleBase> m_warm_start;
+        std::shared_ptr<const Deadline> m_deadline;
 
-        static unsigned int s_num_failures;
+        static const MetricId s_num_failures_id;
+        static const MetricId s_scheduling_time_id;
     };
 
     /*!
@@ -44,6 +44,14 @@ namespace grstapse
             const std::shared_ptr<const Task>& task,
             const std::vector<std::shared_ptr<const Robot>>& coalition) const = 0;
 
+        /*!
+         * \returns An estimate of how long \p coalition will take to accomplish \p task that does not exceed
+         * computeTaskDuration
+         */
+        [[nodiscard]] virtual float computeTaskDurationHeuristic(
+            const std::shared_ptr<const Task>& task,
+            const std::vector<std::shared_ptr<const Robot>>& coalition) const;
+
         /*!
          * \returns Whether the motion plan from a \p robot's initial configuration to a specific \p configuration has
          * already been computed
@@ -0,0 +1,75 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <mutex>
+// External
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/search/memoization_base.hpp"
+#include "grstapse/task_allocation/itags/incremental_task_allocation_node.hpp"
+
+namespace grstapse
+{
+    /*!
+     * \brief A memoization method that identifies a node by the 64-bit Zobrist key of its allocation
+     *
+     * The verification key of the first allocation seen for each key is recorded. If an allocation with a different
+     * verification key produces a key that is already taken, the next free key is used instead, so two different
+     * allocations only share an identifier if both of their independent 64-bit keys collide. Only the two keys are
+     * stored (not the allocation), and the table is guarded so that children can be evaluated in parallel.
+     *
+     * \see PackedAllocation
+     */
+    class AllocationKeyMemoization : public MemoizationBase<IncrementalTaskAllocationNode>
+    {
+       public:
+        //! Default Constructor
+        AllocationKeyMemoization() = default;
+
+        //! \returns The collision-free identifier for the allocation contained by \p node
+        [[nodiscard]] MemoizationKey operator()(
+            const std::shared_ptr<const IncrementalTaskAllocationNode>& node) const final override;
+
+        //! \returns Whether \p lhs and \p rhs contain exactly the same allocation
+        [[nodiscard]] bool equal(const std::shared_ptr<const IncrementalTaskAllocationNode>& lhs,
+                                 const std::shared_ptr<const IncrementalTaskAllocationNode>& rhs) const final override;
+
+        //! \returns The number of Zobrist key collisions that have been resolved
+        [[nodiscard]] inline unsigned int numberOfCollisions() const;
+
+       private:
+        mutable std::mutex m_mutex;
+        mutable robin_hood::unordered_flat_map<MemoizationKey, std::uint64_t> m_verification_keys;
+        mutable unsigned int m_num_collisions = 0;
+    };
+
+    // Inline functions
+    unsigned int AllocationKeyMemoization::numberOfCollisions() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_num_collisions;
+    }
+}  // namespace grstapse
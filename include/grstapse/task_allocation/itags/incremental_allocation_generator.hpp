@@ -25,6 +25,7 @@
 // Local
 #include "grstapse/common/search/successor_generator_base.hpp"
 #include "grstapse/task_allocation/itags/incremental_task_allocation_node.hpp"
+#include "grstapse/task_allocation/itags/robot_symmetry_classes.hpp"
 
 namespace grstapse
 {
@@ -32,6 +33,11 @@ namespace grstapse
 
     /*!
      * Generates nodes that expand a task allocation node by adding a single robot to a single task
+     *
+     * When symmetry breaking is enabled, successors that are not canonical with respect to the interchangeable robots
+     * are skipped, so each permutation class of allocations is only generated once
+     *
+     * \see RobotSymmetryClasses
      */
     class IncrementalAllocationGenerator : public SuccessorGeneratorBase<IncrementalTaskAllocationNode>
     {
@@ -41,9 +47,11 @@ namespace grstapse
         /*!
          * \brief Constructor
          *
-         * \param parameters
+         * \param problem_inputs Inputs to the task allocation problem
+         * \param break_symmetry Whether to only generate canonical allocations for interchangeable robots
          */
-        explicit IncrementalAllocationGenerator(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs);
+        explicit IncrementalAllocationGenerator(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
+                                                bool break_symmetry = false);
 
        private:
         //! \returns Whether the node is valid
@@ -52,5 +60,6 @@ namespace grstapse
 
        private:
         std::shared_ptr<const ItagsProblemInputs> m_problem_inputs;
+        std::shared_ptr<const RobotSymmetryClasses> m_symmetry_classes;  //!< nullptr if no symmetry is broken
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -23,17 +23,22 @@
 #pragma once
 
 // Global
+#include <atomic>
+#include <mutex>
 #include <optional>
 // External
 #include <Eigen/Core>
 // Local
 #include "grstapse/common/search/greedy_best_first_search/greedy_best_first_search_node_base.hpp"
 #include "grstapse/common/utilities/matrix_dimensions.hpp"
+#include "grstapse/scheduling/mutex_set.hpp"
 #include "grstapse/task_allocation/assignment.hpp"
+#include "grstapse/task_allocation/itags/packed_allocation.hpp"
 
 namespace grstapse
 {
     // Forward Declaration
+    class ItagsProblemInputs;
     class ScheduleBase;
 
     //! \brief A node that contains an allocation of agents to tasks
@@ -45,14 +50,19 @@ namespace grstapse
         /*!
          * \brief Constructor for the root node
          * \param dimensions The dimensions of the allocation matrix this node represents
+         * \param arena The arena of the search this node is allocated from (if any)
          */
-        explicit IncrementalTaskAllocationNode(const MatrixDimensions& dimensions, bool use_reverse = false);
+        explicit IncrementalTaskAllocationNode(const MatrixDimensions& dimensions,
+                                               bool use_reverse       = false,
+                                               SearchNodeArena* arena = nullptr);
 
         /*!
          * \brief Constructor for any node except the root node
          *
          * \param assignment The last assignment for the allocation matrix this node represents
          * \param parent The parent of this node
+         *
+         * \note The node shares the arena (and identifier sequence) of its parent
          */
         IncrementalTaskAllocationNode(const Assignment& assignment,
                                       const std::shared_ptr<const IncrementalTaskAllocationNode>& parent,
@@ -71,6 +81,47 @@ namespace grstapse
          */
         virtual Eigen::MatrixXf allocation() const;
 
+        //! \returns The bit-packed allocation contained by this node
+        [[nodiscard]] inline const PackedAllocation& packedAllocation() const;
+
+        //! \returns The 64-bit Zobrist key of the allocation contained by this node
+        [[nodiscard]] inline std::uint64_t allocationKey() const;
+
+        /*!
+         * \returns The traits allocated to each task (A * Q under the problem's reduction)
+         *
+         * \note Computed from the whole allocation on each call (the matrix is not stored by the node)
+         */
+        [[nodiscard]] Eigen::MatrixXf allocatedTraitsMatrix(const ItagsProblemInputs& problem_inputs) const;
+
+        //! \returns The traits allocated to \p task_nr (its row of allocatedTraitsMatrix)
+        [[nodiscard]] Eigen::RowVectorXf allocatedTaskTraits(const ItagsProblemInputs& problem_inputs,
+                                                             unsigned int task_nr) const;
+
+        /*!
+         * \returns The traits mismatch error ||max(Y - A * Q, 0)||_{1,1}
+         *
+         * \note Computed once per node by replacing the error of the last assignment's task in the parent's error.
+         *       Exactly zero iff every task is satisfied
+         */
+        [[nodiscard]] float traitsMismatchError(const ItagsProblemInputs& problem_inputs) const;
+
+        /*!
+         * \returns The mutex constraints of the allocation contained by this node
+         *
+         * \note Computed once per node by updating the parent's mutex set for the last assignment
+         */
+        [[nodiscard]] const MutexSet& mutexSet() const;
+
+        /*!
+         * \returns A lower bound on the makespan of any schedule for the allocation contained by this node
+         *
+         * \note Computed once per node
+         *
+         * \see computeMakespanLowerBound
+         */
+        [[nodiscard]] float makespanLowerBound(const ItagsProblemInputs& problem_inputs) const;
+
         //! Sets the schedule for this node
         inline void setSchedule(const std::shared_ptr<const ScheduleBase>& schedule);
 
@@ -84,13 +135,36 @@ namespace grstapse
         [[nodiscard]] nlohmann::json serializeToJson(
             const std::shared_ptr<const ProblemInputs>& problem_inputs) const override;
 
+       protected:
+        /*!
+         * \brief Constructor for a root node with an existing allocation
+         *
+         * \note Used by unit tests
+         */
+        explicit IncrementalTaskAllocationNode(const PackedAllocation& allocation);
+
        private:
+        //! Computes the traits mismatch error if it has not been already
+        void computeTraits(const ItagsProblemInputs& problem_inputs) const;
+
+        //! \returns The next identifier from \p arena, or from the global sequence if there is no arena
+        [[nodiscard]] static unsigned int nextId(SearchNodeArena* arena);
+
         std::optional<Assignment> m_last_assigment;
-        std::optional<MatrixDimensions> m_matrix_dimensions;
+        PackedAllocation m_allocation;  //!< Copied from the parent and then updated with m_last_assigment
         std::shared_ptr<const ScheduleBase> m_schedule;
         bool m_use_reverse;
 
-        static unsigned int s_next_id;
+        // Lazily computed (at most once, even if evaluated concurrently)
+        mutable std::once_flag m_traits_flag;
+        mutable float m_traits_mismatch_error;
+        mutable unsigned int m_num_unsatisfied_tasks;  //!< Keeps a satisfied allocation's error free of rounding
+        mutable std::once_flag m_mutex_set_flag;
+        mutable MutexSet m_mutex_set;
+        mutable std::once_flag m_makespan_lower_bound_flag;
+        mutable float m_makespan_lower_bound;
+
+        static std::atomic<unsigned int> s_next_id;
     };
 
     // Inline functions
@@ -99,6 +173,16 @@ namespace grstapse
         return m_last_assigment;
     }
 
+    const PackedAllocation& IncrementalTaskAllocationNode::packedAllocation() const
+    {
+        return m_allocation;
+    }
+
+    std::uint64_t IncrementalTaskAllocationNode::allocationKey() const
+    {
+        return m_allocation.key();
+    }
+
     void IncrementalTaskAllocationNode::setSchedule(const std::shared_ptr<const ScheduleBase>& schedule)
     {
         m_schedule = schedule;
@@ -32,6 +32,7 @@
 #include "grstapse/common/search/hash_memoization.hpp"
 #include "grstapse/common/utilities/matrix_dimensions.hpp"
 #include "grstapse/problem_inputs/itags_problem_inputs.hpp"
+#include "grstapse/task_allocation/itags/allocation_key_memoization.hpp"
 #include "grstapse/task_allocation/itags/incremental_allocation_generator.hpp"
 #include "grstapse/task_allocation/itags/incremental_task_allocation_node.hpp"
 #include "grstapse/task_allocation/itags/itags_statistics.hpp"
@@ -111,7 +112,7 @@ namespace grstapse
                     std::make_shared<const TimeExtendedTaskAllocationQuality>(problem_inputs),
                     std::make_shared<const IncrementalAllocationGenerator>(problem_inputs),
                     std::make_shared<const ZeroAprCheck>(problem_inputs),
-                    std::make_shared<const HashMemoization<IncrementalTaskAllocationNode>>(),
+                    std::make_shared<const AllocationKeyMemoization>(),
                     std::make_shared<TraitsImprovementPruning>(problem_inputs),
                     std::make_shared<NullPruningMethod<IncrementalTaskAllocationNode>>(),
                     problem_inputs->useReverse())
@@ -129,7 +130,7 @@ namespace grstapse
                     nullptr,
                     std::make_shared<const IncrementalAllocationGenerator>(problem_inputs),
                     nullptr,
-                    std::make_shared<const HashMemoization<IncrementalTaskAllocationNode>>(),
+                    std::make_shared<const AllocationKeyMemoization>(),
                     nullptr,
                     std::make_shared<NullPruningMethod<IncrementalTaskAllocationNode>>(),
                     problem_inputs->useReverse())
@@ -168,7 +169,7 @@ namespace grstapse
                                                : std::make_shared<const ZeroAprCheck>(parameters.problem_inputs),
                      .memoization        = parameters.memoization != nullptr
                                                ? parameters.memoization
-                                               : std::make_shared<const HashMemoization<IncrementalTaskAllocationNode>>(),
+                                               : std::make_shared<const AllocationKeyMemoization>(),
                      .prepruning_method  = parameters.pre_pruning_method != nullptr
                                                ? parameters.pre_pruning_method
                                                : std::make_shared<TraitsImprovementPruning>(parameters.problem_inputs),
@@ -199,7 +200,7 @@ namespace grstapse
                                                : std::make_shared<const ZeroAprCheck>(parameters.problem_inputs),
                      .memoization        = parameters.memoization != nullptr
                                                ? std::move(parameters.memoization)
-                                               : std::make_shared<const HashMemoization<IncrementalTaskAllocationNode>>(),
+                                               : std::make_shared<const AllocationKeyMemoization>(),
                      .prepruning_method  = parameters.pre_pruning_method != nullptr
                                                ? std::move(parameters.pre_pruning_method)
                                                : std::make_shared<TraitsImprovementPruning>(parameters.problem_inputs),
@@ -220,6 +221,14 @@ namespace grstapse
          */
         [[nodiscard]] std::shared_ptr<IncrementalTaskAllocationNode> createRootNode() override;
 
+        /*!
+         * \copydoc BestFirstSearchBase::searchFromNode
+         *
+         * \note The motion planners of the problem follow the deadline of this search only while it runs
+         */
+        SearchResults<IncrementalTaskAllocationNode, ItagsStatistics> searchFromNode(
+            const std::shared_ptr<IncrementalTaskAllocationNode>& root) override;
+
        private:
         std::shared_ptr<const ItagsProblemInputs> m_problem_inputs;
         bool m_use_reverse;
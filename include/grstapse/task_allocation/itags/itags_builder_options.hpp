@@ -25,6 +25,7 @@
 // Global
 #include <cstdint>
 #include <set>
+#include <string>
 
 namespace grstapse
 {
@@ -39,12 +40,13 @@ namespace grstapse
         //! The options for the scheduling algorithm
         enum class SchedulerOptions : uint8_t
         {
-            e_deterministic_milp = 0,                      //!< \see DeterministicMilpScheduler
-            e_monolithic_stochastic_milp,                  //!< \see MonolithicStochasticMilpScheduler
-            e_benders_stochastic_milp,                     //!< \see BendersStochasticMilpScheduler
-            e_benders_parallel_stochastic_milp,            //!< \see BendersParallelStochasticMilpScheduler
-            e_heuristic_approximation_stochastic_milp,     //!< \see HeuristicApproximationStochasticMilpScheduler
-            e_gnn_heuristic_approximation_stochastic_milp  //!< \see HeuristicApproximationStochasticMilpScheduler
+            e_deterministic_milp = 0,                            //!< \see DeterministicMilpScheduler
+            e_monolithic_stochastic_milp,                        //!< \see MonolithicStochasticMilpScheduler
+            e_benders_stochastic_milp,                           //!< \see BendersStochasticMilpScheduler
+            e_benders_parallel_stochastic_milp,                  //!< \see BendersParallelStochasticMilpScheduler
+            e_heuristic_approximation_stochastic_milp,           //!< \see HeuristicApproximationStochasticMilpScheduler
+            e_gnn_heuristic_approximation_stochastic_milp,       //!< \see HeuristicApproximationStochasticMilpScheduler
+            e_native_gnn_heuristic_approximation_stochastic_milp //!< \see NativeGnnScenarioSelector
         };
         SchedulerOptions scheduler = SchedulerOptions::e_deterministic_milp;
 
@@ -81,7 +83,9 @@ namespace grstapse
         enum class SuccessorGeneratorOptions : uint8_t
         {
             //! \see IncrementalAllocationGenerator
-            e_increment = 0
+            e_increment = 0,
+            //! \see IncrementalAllocationGenerator \see RobotSymmetryClasses
+            e_symmetric_increment
         };
         SuccessorGeneratorOptions successor_generator = SuccessorGeneratorOptions::e_increment;
 
@@ -91,9 +95,11 @@ namespace grstapse
             //! \see NullMemoization
             e_null = 0,
             //! \see HashMemoization
-            e_hash
+            e_hash,
+            //! \see AllocationKeyMemoization
+            e_allocation_key
         };
-        MemoizationOptions memoization = MemoizationOptions::e_hash;
+        MemoizationOptions memoization = MemoizationOptions::e_allocation_key;
 
         //! The command line argument options for the prepruning methods
         enum class PrepruningMethodOptions : uint8_t
@@ -103,7 +109,9 @@ namespace grstapse
             //! \see TraitsImprovementPruning
             e_no_trait_improvement,
             //! \see ItagsPreviousFailurePruningMethod
-            e_previous_failure_reason
+            e_previous_failure_reason,
+            //! \see MakespanLowerBoundPruning
+            e_makespan_lower_bound
         };
         std::set<PrepruningMethodOptions> prepruning = {PrepruningMethodOptions::e_no_trait_improvement};
 
@@ -116,6 +124,11 @@ namespace grstapse
         std::set<PostpruningMethodOptions> postpruning = {PostpruningMethodOptions::e_null};
 
         bool use_reverse = false;
+
+        //! The maximum number of schedules to cache by allocation (0 disables the cache) \see ScheduleCache
+        unsigned int schedule_cache_size = 0;
+        //! The file to persist the schedule cache to, so repeated runs on the same problem can reuse it (optional)
+        std::string schedule_cache_filepath;
     };
 
 }  // namespace grstapse
\ No newline at end of file
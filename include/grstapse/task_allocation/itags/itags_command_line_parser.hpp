@@ -60,6 +60,8 @@ namespace grstapse
         void addPrepruningArguments(CLI::App& app);
         //! Adds the command line arguments for selecting the postpruning to use
         void addPostpruningArguments(CLI::App& app);
+        //! Adds the command line arguments for the schedule cache
+        void addScheduleCacheArguments(CLI::App& app);
 
         std::string m_json_config_filepath;
         std::string m_problem_input_filepath;
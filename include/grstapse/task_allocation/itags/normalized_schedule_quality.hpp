@@ -23,16 +23,19 @@
 #pragma once
 
 // Global
+#include <mutex>
 #include <set>
 #include <tuple>
 // Local
 #include "grstapse/common/search/heuristic_base.hpp"
+#include "grstapse/common/utilities/deadline.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/scheduling/milp/deterministic/deterministic_milp_scheduler.hpp"
 #include "grstapse/scheduling/schedule_base.hpp"
 #include "grstapse/scheduling/scheduler_base.hpp"
 #include "grstapse/scheduling/scheduler_result.hpp"
 #include "grstapse/task_allocation/itags/incremental_task_allocation_node.hpp"
+#include "grstapse/task_allocation/itags/schedule_cache.hpp"
 #include "grstapse/task_allocation/itags/task_allocation_math.hpp"
 
 namespace grstapse
@@ -40,6 +43,8 @@ namespace grstapse
     /*!
      * Evaluates an allocation based on the quality of the makespan from the associated schedule
      *
+     * \note The failure/success callbacks are serialized so that nodes can be evaluated from multiple threads
+     *
      * \see Itags
      *
      * \cite Neville, G., Messing, A., Ravichandar, H., Hutchinson, S., & Chernova, S. (2021, August). An interleaved
@@ -73,14 +78,79 @@ namespace grstapse
         //! \returns The quality of the makespan of the associated schedule
         [[nodiscard]] virtual float operator()(IncrementalTaskAllocationNode* node) const;
 
+        /*!
+         * \returns A lower bound on the quality of the makespan of the associated schedule that does not require
+         *          scheduling
+         *
+         * \see IncrementalTaskAllocationNode::makespanLowerBound
+         */
+        [[nodiscard]] virtual float lowerBound(IncrementalTaskAllocationNode* node) const;
+
+        //! Sets a cache of schedules that is checked before running the scheduler
+        inline void setScheduleCache(const std::shared_ptr<ScheduleCache>& schedule_cache);
+
+        /*!
+         * Sets the deadline of the search this heuristic is used by
+         *
+         * \note The deadline is passed on to each scheduler. Once it expires, nodes are no longer scheduled and
+         *       the results of cut short schedulers are not cached
+         */
+        inline void setDeadline(const std::shared_ptr<const Deadline>& deadline);
+
+        /*!
+         * Sets whether allocations whose makespan lower bound exceeds the worst allowed makespan are failed without
+         * running the scheduler
+         *
+         * \note Such a failure goes through the failure callback with a MakespanLowerBoundFailure
+         *
+         * \see MakespanLowerBoundPruning
+         */
+        inline void setMakespanLowerBoundFilter(bool enabled);
+
        protected:
         //! \returns The makespan for the associated schedule of \p node
         [[nodiscard]] virtual float computeMakespan(IncrementalTaskAllocationNode* node) const;
 
+        /*!
+         * Runs the failure/success callbacks for \p result and sets the schedule of \p node
+         *
+         * \note Used for both new and cached results, so that cache hits are recorded the same way
+         *
+         * \returns The makespan of \p result (infinity if it failed)
+         */
+        [[nodiscard]] float processResult(IncrementalTaskAllocationNode* node,
+                                          const std::shared_ptr<const SchedulerResult>& result) const;
+
+        /*!
+         * \returns Whether \p node could be returned as a goal (and so needs the schedule itself rather than only a
+         *          makespan loaded from the cache file)
+         */
+        [[nodiscard]] bool couldBeGoal(IncrementalTaskAllocationNode* node) const;
+
         std::shared_ptr<const ItagsProblemInputs> m_problem_inputs;
         std::function<std::shared_ptr<SchedulerBase>(const std::shared_ptr<const SchedulerProblemInputs>&)>
             m_create_scheduler;
         std::function<void(const std::shared_ptr<const SchedulerResult>&)> m_on_failure;
         std::function<void(const std::shared_ptr<const SchedulerResult>&)> m_on_success;
+        std::shared_ptr<ScheduleCache> m_schedule_cache;
+        std::shared_ptr<const Deadline> m_deadline;
+        bool m_makespan_lower_bound_filter;
+        mutable std::mutex m_callback_mutex;
     };
+
+    // Inline functions
+    void NormalizedScheduleQuality::setScheduleCache(const std::shared_ptr<ScheduleCache>& schedule_cache)
+    {
+        m_schedule_cache = schedule_cache;
+    }
+
+    void NormalizedScheduleQuality::setDeadline(const std::shared_ptr<const Deadline>& deadline)
+    {
+        m_deadline = deadline;
+    }
+
+    void NormalizedScheduleQuality::setMakespanLowerBoundFilter(bool enabled)
+    {
+        m_makespan_lower_bound_filter = enabled;
+    }
 }  // namespace grstapse
\ No newline at end of file
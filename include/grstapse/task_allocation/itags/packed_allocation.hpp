@@ -0,0 +1,189 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <compare>
+#include <cstdint>
+#include <span>
+#include <vector>
+// External
+#include <Eigen/Core>
+// Local
+#include "grstapse/common/utilities/matrix_dimensions.hpp"
+
+namespace grstapse
+{
+    /*!
+     * \brief A bit-packed allocation matrix (M X N: number_of_tasks X number_of_robots)
+     *
+     * Each task is stored as a row of 64-bit words with one bit per robot. A Zobrist key of the set bits is maintained
+     * alongside the bits, so that it is updated in O(1) whenever a single (task, robot) element changes. A second key
+     * built from an independent table is maintained the same way to verify key collisions without the full bits
+     */
+    class PackedAllocation
+    {
+       public:
+        using Word = std::uint64_t;
+        static constexpr unsigned int k_bits_per_word = 64;
+
+        /*!
+         * \brief Constructor
+         *
+         * \param dimensions The dimensions of the allocation matrix
+         * \param value The initial value of every element of the allocation
+         */
+        explicit PackedAllocation(const MatrixDimensions& dimensions, bool value = false);
+
+        //! \brief Constructor from a dense allocation matrix (non-zero elements are considered allocated)
+        explicit PackedAllocation(const Eigen::MatrixXf& allocation);
+
+        //! \returns Whether \p robot is allocated to \p task
+        [[nodiscard]] inline bool get(unsigned int task, unsigned int robot) const;
+
+        //! \brief Sets whether \p robot is allocated to \p task
+        inline void set(unsigned int task, unsigned int robot, bool value);
+
+        //! \returns The dimensions of the allocation matrix (MxN)
+        [[nodiscard]] inline const MatrixDimensions& dimensions() const;
+
+        //! \returns The number of words used to store a single task (row)
+        [[nodiscard]] inline unsigned int wordsPerTask() const;
+
+        //! \returns The words that store the robots allocated to \p task
+        [[nodiscard]] inline std::span<const Word> taskWords(unsigned int task) const;
+
+        //! \returns The number of robots allocated to \p task
+        [[nodiscard]] unsigned int numberOfRobots(unsigned int task) const;
+
+        //! \returns The total number of (task, robot) assignments
+        [[nodiscard]] unsigned int numberOfAssignments() const;
+
+        //! \returns Whether no robot is allocated to any task
+        [[nodiscard]] bool isZero() const;
+
+        /*!
+         * \brief Lexicographically compares the columns of two robots
+         *
+         * The first task (in index order) that only one of the robots is allocated to decides the order, and the robot
+         * allocated to it is the greater one
+         */
+        [[nodiscard]] std::strong_ordering compareRobots(unsigned int lhs, unsigned int rhs) const;
+
+        //! \returns A dense version of the allocation matrix
+        [[nodiscard]] Eigen::MatrixXf toMatrix() const;
+
+        //! \returns The Zobrist key of the allocation (xor of the keys of all allocated (task, robot) pairs)
+        [[nodiscard]] inline std::uint64_t key() const;
+
+        //! \returns A second Zobrist key of the allocation that is independent of key()
+        [[nodiscard]] inline std::uint64_t verificationKey() const;
+
+        //! \returns A hash of the allocation
+        [[nodiscard]] inline std::size_t hash() const;
+
+        //! \returns The Zobrist key for a single (task, robot) pair
+        [[nodiscard]] static inline std::uint64_t zobristKey(unsigned int task, unsigned int robot);
+
+        //! \returns The verification Zobrist key for a single (task, robot) pair
+        [[nodiscard]] static inline std::uint64_t verificationZobristKey(unsigned int task, unsigned int robot);
+
+        //! Equality operator
+        [[nodiscard]] bool operator==(const PackedAllocation& rhs) const;
+
+       private:
+        MatrixDimensions m_dimensions;
+        unsigned int m_words_per_task;
+        std::vector<Word> m_words;
+        std::uint64_t m_key;
+        std::uint64_t m_verification_key;
+    };
+
+    // Inline functions
+    bool PackedAllocation::get(unsigned int task, unsigned int robot) const
+    {
+        const Word& word = m_words[task * m_words_per_task + robot / k_bits_per_word];
+        return (word >> (robot % k_bits_per_word)) & Word{1};
+    }
+
+    void PackedAllocation::set(unsigned int task, unsigned int robot, bool value)
+    {
+        Word& word      = m_words[task * m_words_per_task + robot / k_bits_per_word];
+        const Word mask = Word{1} << (robot % k_bits_per_word);
+        if(static_cast<bool>(word & mask) == value)
+        {
+            return;
+        }
+        word ^= mask;
+        m_key ^= zobristKey(task, robot);
+        m_verification_key ^= verificationZobristKey(task, robot);
+    }
+
+    const MatrixDimensions& PackedAllocation::dimensions() const
+    {
+        return m_dimensions;
+    }
+
+    unsigned int PackedAllocation::wordsPerTask() const
+    {
+        return m_words_per_task;
+    }
+
+    std::uint64_t PackedAllocation::key() const
+    {
+        return m_key;
+    }
+
+    std::uint64_t PackedAllocation::verificationKey() const
+    {
+        return m_verification_key;
+    }
+
+    std::size_t PackedAllocation::hash() const
+    {
+        return m_key;
+    }
+
+    std::uint64_t PackedAllocation::zobristKey(unsigned int task, unsigned int robot)
+    {
+        // splitmix64 finalizer on the (task, robot) pair acts as a fixed table of random keys
+        std::uint64_t z = ((static_cast<std::uint64_t>(task) << 32) | robot) + 0x9E3779B97F4A7C15ull;
+        z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z               = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    std::uint64_t PackedAllocation::verificationZobristKey(unsigned int task, unsigned int robot)
+    {
+        // murmur3 finalizer on the (robot, task) pair with a different offset acts as a second, independent table
+        std::uint64_t z = ((static_cast<std::uint64_t>(robot) << 32) | task) + 0xD6E8FEB86659FD93ull;
+        z               = (z ^ (z >> 33)) * 0xFF51AFD7ED558CCDull;
+        z               = (z ^ (z >> 33)) * 0xC4CEB9FE1A85EC53ull;
+        return z ^ (z >> 33);
+    }
+
+    std::span<const PackedAllocation::Word> PackedAllocation::taskWords(unsigned int task) const
+    {
+        return {m_words.data() + task * m_words_per_task, m_words_per_task};
+    }
+}  // namespace grstapse
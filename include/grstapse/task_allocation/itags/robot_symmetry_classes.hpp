@@ -0,0 +1,112 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <limits>
+#include <vector>
+// Local
+#include "grstapse/task_allocation/itags/packed_allocation.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ItagsProblemInputs;
+
+    /*!
+     * \brief Groups robots that are interchangeable for task allocation and scheduling
+     *
+     * Two robots are interchangeable if they are of the same species, have identical traits, and start from the same
+     * configuration. Permuting the columns of interchangeable robots in an allocation does not change its APR or the
+     * makespan of its schedule, so only the canonical allocation of each permutation class needs to be searched.
+     *
+     * An allocation is canonical when the columns of the robots in each class are in non-increasing lexicographic
+     * order (by robot index). Every allocation has exactly one canonical permutation, and a canonical allocation can
+     * always be reached from the empty (or full) allocation by single assignment changes through canonical
+     * allocations, so restricting the successors to canonical ones does not disconnect the search space.
+     *
+     * \see PackedAllocation::compareRobots
+     */
+    class RobotSymmetryClasses
+    {
+       public:
+        //! Value used when a robot has no previous/next robot in its class
+        static constexpr unsigned int k_none = std::numeric_limits<unsigned int>::max();
+
+        //! Constructor that detects the classes from the robots in \p problem_inputs
+        explicit RobotSymmetryClasses(const ItagsProblemInputs& problem_inputs);
+
+        /*!
+         * \brief Constructor
+         *
+         * \param classes The class of each robot (robots with the same value are interchangeable)
+         */
+        explicit RobotSymmetryClasses(const std::vector<unsigned int>& classes);
+
+        //! \returns Whether any two robots are interchangeable
+        [[nodiscard]] inline bool hasSymmetry() const;
+
+        //! \returns The number of classes
+        [[nodiscard]] inline unsigned int numberOfClasses() const;
+
+        //! \returns The class of \p robot
+        [[nodiscard]] inline unsigned int robotClass(unsigned int robot) const;
+
+        /*!
+         * \returns Whether the order of the column of \p robot relative to the adjacent robots in its class is
+         *          canonical
+         *
+         * \note If \p allocation only differs from a canonical allocation in the column of \p robot, then this is
+         *       equivalent to \p allocation being canonical
+         */
+        [[nodiscard]] bool isCanonical(const PackedAllocation& allocation, unsigned int robot) const;
+
+        //! \returns Whether \p allocation is canonical
+        [[nodiscard]] bool isCanonical(const PackedAllocation& allocation) const;
+
+       private:
+        //! Links each robot to the adjacent robots in its class
+        void link();
+
+        std::vector<unsigned int> m_classes;
+        std::vector<unsigned int> m_previous;
+        std::vector<unsigned int> m_next;
+        unsigned int m_num_classes;
+    };
+
+    // Inline functions
+    bool RobotSymmetryClasses::hasSymmetry() const
+    {
+        return m_num_classes < m_classes.size();
+    }
+
+    unsigned int RobotSymmetryClasses::numberOfClasses() const
+    {
+        return m_num_classes;
+    }
+
+    unsigned int RobotSymmetryClasses::robotClass(unsigned int robot) const
+    {
+        return m_classes[robot];
+    }
+}  // namespace grstapse
\ No newline at end of file
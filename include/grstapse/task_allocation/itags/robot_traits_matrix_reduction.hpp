@@ -36,6 +36,10 @@
 
 namespace grstapse
 {
+    // Forward Declarations
+    struct Assignment;
+    class PackedAllocation;
+
     enum class TraitsMatrixReductionTypes : uint8_t
     {
         e_summation,
@@ -85,6 +89,36 @@ namespace grstapse
         [[nodiscard]] Eigen::MatrixXf reduce(const Eigen::MatrixXf& allocation,
                                              const Eigen::MatrixXf& robot_traits_matrix) const;
 
+        /*!
+         * Reduces the traits of the robots allocated to a single task
+         *
+         * \param allocation The allocation for the coalition
+         * \param task_nr The task to reduce the traits for
+         * \param robot_traits_matrix A matrix representing the traits of the entire team
+         *
+         * \returns The row of the allocated traits matrix for \p task_nr (computed in O(N * T))
+         */
+        [[nodiscard]] Eigen::RowVectorXf reduceTask(const PackedAllocation& allocation,
+                                                    unsigned int task_nr,
+                                                    const Eigen::MatrixXf& robot_traits_matrix) const;
+
+        /*!
+         * Updates the row of an allocated traits matrix for a task after a single robot has been added to or removed
+         * from it
+         *
+         * \param allocated_traits_matrix The allocated traits matrix before the change (updated in place)
+         * \param allocation The allocation after the change
+         * \param assignment The (task, robot) element that changed
+         * \param robot_traits_matrix A matrix representing the traits of the entire team
+         *
+         * \note The row is recomputed from the robots allocated to the task in O(N * T), so its value only depends on
+         *       the allocation and not on the order in which robots were added or removed
+         */
+        void update(Eigen::MatrixXf& allocated_traits_matrix,
+                    const PackedAllocation& allocation,
+                    const Assignment& assignment,
+                    const Eigen::MatrixXf& robot_traits_matrix) const;
+
        protected:
         /*!
          * \brief allocation * robot_traits_matrix
@@ -102,6 +136,11 @@ namespace grstapse
         [[nodiscard]] Eigen::MatrixXf reduce_EigenReduction(const Eigen::MatrixXf& allocation,
                                                             const Eigen::MatrixXf& robot_traits_matrix) const;
 
+        //! \returns The reduction of a single (task, trait) element given the trait values of the allocated robots
+        [[nodiscard]] float reduceElement(unsigned int task_nr,
+                                          unsigned int trait_nr,
+                                          const Eigen::VectorXf& allocated_traits) const;
+
        private:
         bool m_matrix_multiply;  // true only if all elements of m_reduction_types are e_summation
         std::vector<std::vector<TraitsMatrixReductionTypes>> m_reduction_types;
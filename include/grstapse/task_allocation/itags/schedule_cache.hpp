@@ -0,0 +1,148 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <atomic>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+// External
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
+#include "grstapse/task_allocation/itags/packed_allocation.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ItagsProblemInputs;
+    class SchedulerResult;
+
+    /*!
+     * \brief A bounded, thread-safe cache of scheduling results keyed by the exact allocation
+     *
+     * A cache is only valid for a single problem and scheduler configuration. The configuration string is stored with
+     * the cache file and a file with a different configuration is ignored when loading. When the capacity is reached
+     * the least recently used entry is evicted.
+     *
+     * \note Entries loaded from a file only contain the makespan (the schedule itself is not persisted), so they are
+     *       only used to rank nodes. Failures are not persisted as their failure reason cannot be restored
+     *
+     * \see NormalizedScheduleQuality
+     */
+    class ScheduleCache : public Noncopyable
+    {
+       public:
+        //! A cached scheduling result
+        struct Entry
+        {
+            float makespan;                                  //!< Infinity if the scheduler failed
+            std::shared_ptr<const SchedulerResult> result;  //!< nullptr if the entry was loaded from a file
+        };
+
+        /*!
+         * \brief Constructor
+         *
+         * \param capacity The maximum number of entries
+         * \param configuration An identifier for the problem and scheduler configuration
+         * \param filepath The file to persist the cache to (empty for an in-memory cache only)
+         */
+        ScheduleCache(std::size_t capacity,
+                      const std::string& configuration,
+                      const std::filesystem::path& filepath = std::filesystem::path());
+
+        //! Destructor (saves to the file if there is one)
+        ~ScheduleCache();
+
+        //! \returns The cached result for \p allocation if there is one
+        [[nodiscard]] std::optional<Entry> find(const PackedAllocation& allocation);
+
+        //! Adds the result of scheduling \p allocation to the cache
+        void insert(const PackedAllocation& allocation, const std::shared_ptr<const SchedulerResult>& result);
+
+        /*!
+         * Loads the entries from the cache file (if it exists and matches the configuration)
+         *
+         * \note A malformed file is ignored with a warning and the cache is left empty
+         */
+        void load();
+
+        //! Writes the entries to the cache file
+        void save() const;
+
+        //! \returns The number of entries in the cache
+        [[nodiscard]] std::size_t size() const;
+
+        //! \returns The number of lookups that found an entry
+        [[nodiscard]] inline unsigned int numberOfHits() const;
+
+        //! \returns The number of lookups that did not find an entry
+        [[nodiscard]] inline unsigned int numberOfMisses() const;
+
+        /*!
+         * \returns A hash of everything about \p problem_inputs that a makespan depends on (the tasks' durations,
+         *          traits and configurations, the robots' traits, speeds and initial configurations, the precedence
+         *          constraints, and the motion planners and environments)
+         */
+        [[nodiscard]] static std::size_t problemHash(const ItagsProblemInputs& problem_inputs);
+
+       private:
+        struct AllocationHash
+        {
+            std::size_t operator()(const PackedAllocation& allocation) const
+            {
+                return allocation.hash();
+            }
+        };
+        using List_  = std::list<std::pair<PackedAllocation, Entry>>;
+        using Index_ = robin_hood::unordered_map<PackedAllocation, List_::iterator, AllocationHash>;
+
+        //! Inserts an entry while m_mutex is held
+        void insertUnlocked(const PackedAllocation& allocation, Entry&& entry);
+
+        std::size_t m_capacity;
+        std::string m_configuration;
+        std::filesystem::path m_filepath;
+
+        mutable std::mutex m_mutex;
+        List_ m_entries;  //!< Most recently used first
+        Index_ m_index;
+        std::atomic<unsigned int> m_num_hits;
+        std::atomic<unsigned int> m_num_misses;
+    };
+
+    // Inline functions
+    unsigned int ScheduleCache::numberOfHits() const
+    {
+        return m_num_hits;
+    }
+
+    unsigned int ScheduleCache::numberOfMisses() const
+    {
+        return m_num_misses;
+    }
+}  // namespace grstapse
@@ -68,18 +68,28 @@ namespace grstapse
                                             const Eigen::MatrixXf& desired_traits_matrix,
                                             const Eigen::MatrixXf& robot_traits_matrix);
 
+    //! \returns The traits mismatch error for a single task given its row of the allocated traits matrix
+    [[nodiscard]] float taskTraitsMismatchError(const Eigen::RowVectorXf& allocated_task_traits,
+                                                const Eigen::MatrixXf& desired_traits_matrix,
+                                                unsigned int task_nr);
+
     //! \returns The traits linear quality
     [[nodiscard]] float traitsLinearQualityCalculator(const RobotTraitsMatrixReduction& robot_traits_matrix_reduction,
                                                       const Eigen::MatrixXf& allocation,
                                                       const Eigen::MatrixXf& linear_coefficient_matrix,
                                                       const Eigen::MatrixXf& robot_traits_matrix);
 
-    //! \returns A set of the mutex constraints for an allocation
+    /*!
+     * \returns A set of the mutex constraints for an allocation
+     *
+     * \see MutexSet
+     */
     std::set<std::pair<unsigned int, unsigned int>> computeMutexConstraints(const Eigen::MatrixXf& allocation);
 
     /*!
      * Updates the set by adding transitive constraints (0,1) ^ (1,2) -> (0, 2)
      *
+     * \see PrecedenceClosure
      * \returns The updated set
      */
     std::set<std::pair<unsigned int, unsigned int>> addPrecedenceTransitiveConstraints(
@@ -77,6 +77,10 @@ namespace grstapse
         //! \returns A combination of APR and NSQ heuristics
         [[nodiscard]] float operator()(const std::shared_ptr<IncrementalTaskAllocationNode>& node) const final override;
 
+        //! \returns A combination of APR and a lower bound on NSQ that does not require scheduling
+        [[nodiscard]] float optimisticEstimate(
+            const std::shared_ptr<IncrementalTaskAllocationNode>& node) const final override;
+
        protected:
         float m_alpha;
         std::shared_ptr<const AllocationPercentageRemaining> m_apr;
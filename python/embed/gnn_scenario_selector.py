@@ -1,3 +1,4 @@
+import json
 import os
 import pickle
 
@@ -188,6 +189,55 @@ def load_gnn(model_path, params_path, use_cpu=False, gpu_id=0):
     return [model, device]
 
 
+def export_gnn(model_path, params_path, output_path):
+    """
+    Exports the weights of a trained model to a json file that can be loaded by grstapse::GatedGcn (C++), which runs
+    the model without python
+
+    :param model_path: path to the state dict of the trained model
+    :param params_path: path to the pickled net parameters of the trained model
+    :param output_path: path to write the json file to
+    """
+    net_params = pickle.load(open(params_path, "rb"))
+    net_params['device'] = torch.device('cpu')
+    if net_params['pos_enc']:
+        raise ValueError('Positional encodings are not supported by the C++ model')
+
+    model = GatedGCNNet(net_params)
+    model.load_state_dict(torch.load(model_path, map_location=torch.device('cpu')))
+    model.eval()
+
+    def linear(layer):
+        return {'weight': layer.weight.detach().tolist(), 'bias': layer.bias.detach().tolist()}
+
+    def batch_norm(layer):
+        return {'weight': layer.weight.detach().tolist(),
+                'bias': layer.bias.detach().tolist(),
+                'running_mean': layer.running_mean.tolist(),
+                'running_var': layer.running_var.tolist(),
+                'eps': float(layer.eps)}
+
+    weights = {
+        'readout': model.readout,
+        'batch_norm': bool(model.batch_norm),
+        # Layers only use residual connections when their input and output dimensions match (always for hidden_dim)
+        'residual': bool(model.residual),
+        'use_edge_features': bool(model.edge_feat),
+        'node_embedding': linear(model.embedding_h),
+        'edge_embedding': linear(model.embedding_e),
+        'layers': [{'node_self': linear(layer.A),
+                    'node_neighbor': linear(layer.B),
+                    'edge_self': linear(layer.C),
+                    'edge_source': linear(layer.D),
+                    'edge_destination': linear(layer.E),
+                    'node_batch_norm': batch_norm(layer.bn_node_h),
+                    'edge_batch_norm': batch_norm(layer.bn_node_e)} for layer in model.layers],
+        'readout_layers': [linear(layer) for layer in model.MLP_layer.FC_layers]
+    }
+    with open(output_path, 'w') as f:
+        json.dump(weights, f)
+
+
 def get_graph(scenario, n_tasks, precedence_constraints, mutex_constraints, model_data):
     g = dgl.DGLGraph()
     g.add_nodes(n_tasks)
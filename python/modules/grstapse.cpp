@@ -81,7 +81,9 @@ PYBIND11_MODULE(grstapse, module)
             .def_readwrite("memoization", &grstapse::ItagsBuilderOptions::memoization)
             .def_readwrite("prepruning", &grstapse::ItagsBuilderOptions::prepruning)
             .def_readwrite("postpruning", &grstapse::ItagsBuilderOptions::postpruning)
-            .def_readwrite("use_reverse", &grstapse::ItagsBuilderOptions::use_reverse);
+            .def_readwrite("use_reverse", &grstapse::ItagsBuilderOptions::use_reverse)
+            .def_readwrite("schedule_cache_size", &grstapse::ItagsBuilderOptions::schedule_cache_size)
+            .def_readwrite("schedule_cache_filepath", &grstapse::ItagsBuilderOptions::schedule_cache_filepath);
         CREATE_ENUM(itags_builder_options, SchedulerOptions)
         CREATE_ENUM(itags_builder_options, HeuristicOptions)
         CREATE_ENUM(itags_builder_options, GoalCheckOptions)
@@ -125,7 +127,11 @@ PYBIND11_MODULE(grstapse, module)
         pybind11::class_<grstapse::SchedulerProblemInputs, std::shared_ptr<grstapse::SchedulerProblemInputs>>
             scheduler_problem_inputs(scheduling_module, "SchedulerProblemInputs");
         scheduler_problem_inputs.def("precedenceConstraints", &grstapse::SchedulerProblemInputs::precedenceConstraints)
-            .def("mutexConstraints", &grstapse::SchedulerProblemInputs::mutexConstraints)
+            .def("mutexConstraints",
+                 [](const grstapse::SchedulerProblemInputs& problem_inputs)
+                 {
+                     return problem_inputs.mutexSet().constraints();
+                 })
             .def("numberOfPlanTasks", &grstapse::SchedulerProblemInputs::numberOfPlanTasks);
         scheduling_module.def("loadProblemInputsFromFile",
                               &grstapse::json_ext::loadJsonFromFile<std::shared_ptr<grstapse::SchedulerProblemInputs>>);
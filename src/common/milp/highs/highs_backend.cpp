@@ -0,0 +1,912 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifdef GRSTAPSE_USE_HIGHS
+#include "grstapse/common/milp/highs/highs_backend.hpp"
+
+// Global
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <tuple>
+// External
+#include <Highs.h>
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+
+namespace grstapse::highs_backend
+{
+    struct ModelData
+    {
+        Highs highs;
+        Parameters parameters;
+        int sense             = GRB_MINIMIZE;
+        int status            = GRB_LOADED;
+        bool has_solution     = false;
+        GRBCallback* callback = nullptr;
+        HighsSolution solution;
+        std::vector<double> start;      //!< MIP start value for each column (GRB_UNDEFINED if not set)
+        std::vector<char> row_senses;  //!< Sense of each row
+        std::vector<std::tuple<int, int, GRBLinExpr>> objectives;  //!< index, priority, expression
+        std::unordered_map<std::string, int> variable_names;
+        std::unordered_map<std::string, int> constraint_names;
+    };
+
+    namespace
+    {
+        //! \returns \p value with gurobi's infinity replaced by HiGHS's
+        double toHighs(double value)
+        {
+            if(value >= GRB_INFINITY)
+            {
+                return kHighsInf;
+            }
+            if(value <= -GRB_INFINITY)
+            {
+                return -kHighsInf;
+            }
+            return value;
+        }
+
+        //! \returns \p value with HiGHS's infinity replaced by gurobi's
+        double fromHighs(double value)
+        {
+            if(value >= kHighsInf)
+            {
+                return GRB_INFINITY;
+            }
+            if(value <= -kHighsInf)
+            {
+                return -GRB_INFINITY;
+            }
+            return value;
+        }
+
+        void setParameter(Parameters& parameters, GRB_IntParam parameter, int value)
+        {
+            switch(parameter)
+            {
+                case GRB_IntParam_Method:
+                {
+                    parameters.method = value;
+                    break;
+                }
+                case GRB_IntParam_LogToConsole:
+                case GRB_IntParam_OutputFlag:
+                {
+                    parameters.log_to_console = value != 0;
+                    break;
+                }
+                case GRB_IntParam_LazyConstraints:
+                {
+                    parameters.lazy_constraints = value != 0;
+                    break;
+                }
+                // HiGHS uses a single process-wide thread pool and only returns the incumbent
+                case GRB_IntParam_Threads:
+                case GRB_IntParam_PoolSolutions:
+                case GRB_IntParam_SolutionNumber:
+                {
+                    break;
+                }
+            }
+        }
+
+        void setParameter(Parameters& parameters, GRB_DoubleParam parameter, double value)
+        {
+            switch(parameter)
+            {
+                case GRB_DoubleParam_TimeLimit:
+                {
+                    parameters.time_limit = value;
+                    break;
+                }
+                case GRB_DoubleParam_MIPGap:
+                {
+                    parameters.mip_gap = value;
+                    break;
+                }
+                case GRB_DoubleParam_Heuristics:
+                {
+                    parameters.heuristics = value;
+                    break;
+                }
+            }
+        }
+
+        //! \returns The gurobi status code that corresponds to \p status
+        int convertStatus(const Highs& highs, HighsModelStatus status)
+        {
+            switch(status)
+            {
+                case HighsModelStatus::kOptimal:
+                case HighsModelStatus::kModelEmpty:
+                {
+                    return GRB_OPTIMAL;
+                }
+                case HighsModelStatus::kInfeasible:
+                {
+                    return GRB_INFEASIBLE;
+                }
+                case HighsModelStatus::kUnbounded:
+                {
+                    return GRB_UNBOUNDED;
+                }
+                case HighsModelStatus::kUnboundedOrInfeasible:
+                {
+                    return GRB_INF_OR_UNBD;
+                }
+                case HighsModelStatus::kObjectiveBound:
+                case HighsModelStatus::kObjectiveTarget:
+                {
+                    return GRB_SUBOPTIMAL;
+                }
+                // Any other limit is treated as a timeout
+                case HighsModelStatus::kTimeLimit:
+                case HighsModelStatus::kIterationLimit:
+                case HighsModelStatus::kSolutionLimit:
+                case HighsModelStatus::kInterrupt:
+                {
+                    return GRB_TIME_LIMIT;
+                }
+                default:
+                {
+                    throw grstapse::createLogicError(
+                        fmt::format("HiGHS failed to solve the model ({})", highs.modelStatusToString(status)));
+                }
+            }
+        }
+
+        //! Relative tolerance used to decide whether a lazy constraint cuts off the incumbent
+        constexpr double k_lazy_tolerance = 1e-5;
+    }  // namespace
+}  // namespace grstapse::highs_backend
+
+using grstapse::createLogicError;
+using grstapse::highs_backend::ModelData;
+
+GRBEnv::GRBEnv(bool)
+    : m_parameters()
+{}
+
+void GRBEnv::start()
+{
+    // Nothing is deferred
+}
+
+void GRBEnv::set(GRB_IntParam parameter, int value)
+{
+    grstapse::highs_backend::setParameter(m_parameters, parameter, value);
+}
+
+void GRBEnv::set(GRB_DoubleParam parameter, double value)
+{
+    grstapse::highs_backend::setParameter(m_parameters, parameter, value);
+}
+
+std::string GRBEnv::getErrorMsg() const
+{
+    return "";
+}
+
+GRBVar::GRBVar()
+    : m_data(nullptr)
+    , m_index(-1)
+{}
+
+GRBVar::GRBVar(ModelData* data, int index)
+    : m_data(data)
+    , m_index(index)
+{}
+
+double GRBVar::get(GRB_DoubleAttr attribute) const
+{
+    if(m_data == nullptr)
+    {
+        throw createLogicError("Invalid variable");
+    }
+    switch(attribute)
+    {
+        case GRB_DoubleAttr_X:
+        {
+            if(!m_data->has_solution)
+            {
+                throw createLogicError("No solution is available");
+            }
+            return m_data->solution.col_value[m_index];
+        }
+        case GRB_DoubleAttr_LB:
+        {
+            return grstapse::highs_backend::fromHighs(m_data->highs.getLp().col_lower_[m_index]);
+        }
+        case GRB_DoubleAttr_UB:
+        {
+            return grstapse::highs_backend::fromHighs(m_data->highs.getLp().col_upper_[m_index]);
+        }
+        case GRB_DoubleAttr_Start:
+        {
+            return m_data->start[m_index];
+        }
+        default:
+        {
+            throw createLogicError("Unsupported variable attribute");
+        }
+    }
+}
+
+void GRBVar::set(GRB_DoubleAttr attribute, double value)
+{
+    if(m_data == nullptr)
+    {
+        throw createLogicError("Invalid variable");
+    }
+    const HighsLp& lp = m_data->highs.getLp();
+    switch(attribute)
+    {
+        case GRB_DoubleAttr_LB:
+        {
+            m_data->highs.changeColBounds(m_index, grstapse::highs_backend::toHighs(value), lp.col_upper_[m_index]);
+            break;
+        }
+        case GRB_DoubleAttr_UB:
+        {
+            m_data->highs.changeColBounds(m_index, lp.col_lower_[m_index], grstapse::highs_backend::toHighs(value));
+            break;
+        }
+        case GRB_DoubleAttr_Start:
+        {
+            m_data->start[m_index] = value;
+            break;
+        }
+        default:
+        {
+            throw createLogicError("Unsupported variable attribute");
+        }
+    }
+}
+
+bool GRBVar::sameAs(const GRBVar& other) const
+{
+    return m_data == other.m_data && m_index == other.m_index;
+}
+
+GRBConstr::GRBConstr()
+    : m_data(nullptr)
+    , m_index(-1)
+{}
+
+GRBConstr::GRBConstr(ModelData* data, int index)
+    : m_data(data)
+    , m_index(index)
+{}
+
+double GRBConstr::get(GRB_DoubleAttr attribute) const
+{
+    if(m_data == nullptr)
+    {
+        throw createLogicError("Invalid constraint");
+    }
+    switch(attribute)
+    {
+        case GRB_DoubleAttr_RHS:
+        {
+            const HighsLp& lp = m_data->highs.getLp();
+            return m_data->row_senses[m_index] == GRB_LESS_EQUAL ? lp.row_upper_[m_index] : lp.row_lower_[m_index];
+        }
+        case GRB_DoubleAttr_Pi:
+        {
+            if(!m_data->solution.dual_valid)
+            {
+                throw createLogicError("Dual values are only available for solved continuous models");
+            }
+            return m_data->solution.row_dual[m_index];
+        }
+        default:
+        {
+            throw createLogicError("Unsupported constraint attribute");
+        }
+    }
+}
+
+void GRBConstr::set(GRB_DoubleAttr attribute, double value)
+{
+    if(m_data == nullptr)
+    {
+        throw createLogicError("Invalid constraint");
+    }
+    if(attribute != GRB_DoubleAttr_RHS)
+    {
+        throw createLogicError("Unsupported constraint attribute");
+    }
+    switch(m_data->row_senses[m_index])
+    {
+        case GRB_LESS_EQUAL:
+        {
+            m_data->highs.changeRowBounds(m_index, -kHighsInf, value);
+            break;
+        }
+        case GRB_GREATER_EQUAL:
+        {
+            m_data->highs.changeRowBounds(m_index, value, kHighsInf);
+            break;
+        }
+        default:
+        {
+            m_data->highs.changeRowBounds(m_index, value, value);
+        }
+    }
+}
+
+GRBLinExpr::GRBLinExpr(double constant)
+    : m_constant(constant)
+{}
+
+GRBLinExpr::GRBLinExpr(const GRBVar& var, double coefficient)
+    : m_terms{{var, coefficient}}
+    , m_constant(0.0)
+{}
+
+double GRBLinExpr::getValue() const
+{
+    double value = m_constant;
+    for(const auto& [var, coefficient]: m_terms)
+    {
+        value += coefficient * var.get(GRB_DoubleAttr_X);
+    }
+    return value;
+}
+
+GRBLinExpr& GRBLinExpr::operator+=(const GRBLinExpr& rhs)
+{
+    m_terms.insert(m_terms.end(), rhs.m_terms.begin(), rhs.m_terms.end());
+    m_constant += rhs.m_constant;
+    return *this;
+}
+
+GRBLinExpr& GRBLinExpr::operator-=(const GRBLinExpr& rhs)
+{
+    m_terms.reserve(m_terms.size() + rhs.m_terms.size());
+    for(const auto& [var, coefficient]: rhs.m_terms)
+    {
+        m_terms.emplace_back(var, -coefficient);
+    }
+    m_constant -= rhs.m_constant;
+    return *this;
+}
+
+GRBLinExpr& GRBLinExpr::operator*=(double multiplier)
+{
+    for(auto& term: m_terms)
+    {
+        term.second *= multiplier;
+    }
+    m_constant *= multiplier;
+    return *this;
+}
+
+double GRBLinExpr::evaluate(const std::vector<double>& values) const
+{
+    double value = m_constant;
+    for(const auto& [var, coefficient]: m_terms)
+    {
+        value += coefficient * values[var.index()];
+    }
+    return value;
+}
+
+std::map<int, double> GRBLinExpr::combinedTerms() const
+{
+    std::map<int, double> terms;
+    for(const auto& [var, coefficient]: m_terms)
+    {
+        terms[var.index()] += coefficient;
+    }
+    return terms;
+}
+
+GRBLinExpr operator+(const GRBLinExpr& lhs, const GRBLinExpr& rhs)
+{
+    GRBLinExpr rv = lhs;
+    rv += rhs;
+    return rv;
+}
+
+GRBLinExpr operator-(const GRBLinExpr& lhs, const GRBLinExpr& rhs)
+{
+    GRBLinExpr rv = lhs;
+    rv -= rhs;
+    return rv;
+}
+
+GRBLinExpr operator-(const GRBLinExpr& expr)
+{
+    GRBLinExpr rv = expr;
+    rv *= -1.0;
+    return rv;
+}
+
+GRBLinExpr operator*(double multiplier, const GRBLinExpr& expr)
+{
+    GRBLinExpr rv = expr;
+    rv *= multiplier;
+    return rv;
+}
+
+GRBLinExpr operator*(const GRBLinExpr& expr, double multiplier)
+{
+    return multiplier * expr;
+}
+
+GRBTempConstr::GRBTempConstr(const GRBLinExpr& lhs, char sense, const GRBLinExpr& rhs)
+    : m_expr(lhs - rhs)
+    , m_sense(sense)
+{}
+
+bool GRBTempConstr::violated(const std::vector<double>& values, double tolerance) const
+{
+    // Scale the tolerance by the magnitude of the terms so big-M constraints are not cut by round off
+    double scale = 1.0 + std::abs(m_expr.getConstant());
+    for(const auto& [var, coefficient]: m_expr.m_terms)
+    {
+        scale += std::abs(coefficient * values[var.index()]);
+    }
+    const double value = m_expr.evaluate(values);
+    switch(m_sense)
+    {
+        case GRB_LESS_EQUAL:
+        {
+            return value > tolerance * scale;
+        }
+        case GRB_GREATER_EQUAL:
+        {
+            return value < -tolerance * scale;
+        }
+        default:
+        {
+            return std::abs(value) > tolerance * scale;
+        }
+    }
+}
+
+GRBTempConstr operator<=(const GRBLinExpr& lhs, const GRBLinExpr& rhs)
+{
+    return GRBTempConstr(lhs, GRB_LESS_EQUAL, rhs);
+}
+
+GRBTempConstr operator>=(const GRBLinExpr& lhs, const GRBLinExpr& rhs)
+{
+    return GRBTempConstr(lhs, GRB_GREATER_EQUAL, rhs);
+}
+
+GRBTempConstr operator==(const GRBLinExpr& lhs, const GRBLinExpr& rhs)
+{
+    return GRBTempConstr(lhs, GRB_EQUAL, rhs);
+}
+
+GRBCallback::GRBCallback()
+    : where(0)
+    , m_solution(nullptr)
+    , m_aborted(false)
+{}
+
+double GRBCallback::getSolution(const GRBVar& var)
+{
+    if(m_solution == nullptr)
+    {
+        throw createLogicError("The solution is only available while the callback is running");
+    }
+    return (*m_solution)[var.index()];
+}
+
+void GRBCallback::addLazy(const GRBTempConstr& constraint)
+{
+    m_lazy_constraints.push_back(constraint);
+}
+
+void GRBCallback::addLazy(const GRBLinExpr& expr, char sense, double rhs)
+{
+    m_lazy_constraints.emplace_back(expr, sense, GRBLinExpr(rhs));
+}
+
+void GRBCallback::abort()
+{
+    m_aborted = true;
+}
+
+std::vector<GRBTempConstr> GRBCallback::run(const std::vector<double>& solution)
+{
+    m_lazy_constraints.clear();
+    m_aborted = false;
+    m_solution = &solution;
+    where      = GRB_CB_MIPSOL;
+    callback();
+    m_solution = nullptr;
+    return std::move(m_lazy_constraints);
+}
+
+GRBModel::GRBModel(const GRBEnv& env)
+    : m_data(std::make_unique<ModelData>())
+{
+    m_data->parameters = env.m_parameters;
+}
+
+GRBModel::~GRBModel() = default;
+
+GRBVar GRBModel::addVar(double lower_bound, double upper_bound, double objective, char type, const std::string& name)
+{
+    const int column = m_data->highs.getNumCol();
+    if(type == GRB_BINARY)
+    {
+        lower_bound = std::max(lower_bound, 0.0);
+        upper_bound = std::min(upper_bound, 1.0);
+    }
+    m_data->highs.addCol(objective,
+                         grstapse::highs_backend::toHighs(lower_bound),
+                         grstapse::highs_backend::toHighs(upper_bound),
+                         0,
+                         nullptr,
+                         nullptr);
+    if(type == GRB_BINARY || type == GRB_INTEGER)
+    {
+        m_data->highs.changeColIntegrality(column, HighsVarType::kInteger);
+    }
+    m_data->start.push_back(GRB_UNDEFINED);
+    if(!name.empty())
+    {
+        m_data->variable_names[name] = column;
+    }
+    return GRBVar(m_data.get(), column);
+}
+
+GRBConstr GRBModel::addConstr(const GRBTempConstr& constraint, const std::string& name)
+{
+    const int row = addRow(constraint);
+    if(!name.empty())
+    {
+        m_data->constraint_names[name] = row;
+    }
+    return GRBConstr(m_data.get(), row);
+}
+
+int GRBModel::addRow(const GRBTempConstr& constraint)
+{
+    const std::map<int, double> terms = constraint.m_expr.combinedTerms();
+    std::vector<HighsInt> indices;
+    std::vector<double> values;
+    indices.reserve(terms.size());
+    values.reserve(terms.size());
+    for(auto [index, coefficient]: terms)
+    {
+        indices.push_back(index);
+        values.push_back(coefficient);
+    }
+
+    const double rhs = -constraint.m_expr.getConstant();
+    const double lower =
+        constraint.m_sense == GRB_LESS_EQUAL ? -kHighsInf : grstapse::highs_backend::toHighs(rhs);
+    const double upper =
+        constraint.m_sense == GRB_GREATER_EQUAL ? kHighsInf : grstapse::highs_backend::toHighs(rhs);
+
+    const int row = m_data->highs.getNumRow();
+    m_data->highs.addRow(lower, upper, static_cast<HighsInt>(indices.size()), indices.data(), values.data());
+    m_data->row_senses.push_back(constraint.m_sense);
+    return row;
+}
+
+void GRBModel::setObjective(const GRBLinExpr& expr, int sense)
+{
+    m_data->objectives.clear();
+    m_data->objectives.emplace_back(0, 0, expr);
+    if(sense != 0)
+    {
+        m_data->sense = sense;
+    }
+}
+
+void GRBModel::setObjectiveN(const GRBLinExpr& expr,
+                             int index,
+                             int priority,
+                             double,
+                             double,
+                             double,
+                             const std::string&)
+{
+    auto iter = std::find_if(m_data->objectives.begin(),
+                             m_data->objectives.end(),
+                             [index](const std::tuple<int, int, GRBLinExpr>& objective) -> bool
+                             {
+                                 return std::get<0>(objective) == index;
+                             });
+    if(iter != m_data->objectives.end())
+    {
+        *iter = std::make_tuple(index, priority, expr);
+    }
+    else
+    {
+        m_data->objectives.emplace_back(index, priority, expr);
+    }
+}
+
+void GRBModel::setCosts(const GRBLinExpr& expr)
+{
+    const int num_columns = m_data->highs.getNumCol();
+    if(num_columns == 0)
+    {
+        return;
+    }
+    std::vector<double> costs(num_columns, 0.0);
+    for(auto [index, coefficient]: expr.combinedTerms())
+    {
+        costs[index] = coefficient;
+    }
+    m_data->highs.changeColsCost(0, num_columns - 1, costs.data());
+    m_data->highs.changeObjectiveOffset(expr.getConstant());
+}
+
+void GRBModel::setCallback(GRBCallback* callback)
+{
+    m_data->callback = callback;
+}
+
+GRBVar GRBModel::getVarByName(const std::string& name) const
+{
+    auto iter = m_data->variable_names.find(name);
+    if(iter == m_data->variable_names.end())
+    {
+        throw createLogicError(fmt::format("Unknown variable '{}'", name));
+    }
+    return GRBVar(m_data.get(), iter->second);
+}
+
+GRBConstr GRBModel::getConstrByName(const std::string& name) const
+{
+    auto iter = m_data->constraint_names.find(name);
+    if(iter == m_data->constraint_names.end())
+    {
+        throw createLogicError(fmt::format("Unknown constraint '{}'", name));
+    }
+    return GRBConstr(m_data.get(), iter->second);
+}
+
+int GRBModel::get(GRB_IntAttr attribute) const
+{
+    switch(attribute)
+    {
+        case GRB_IntAttr_ModelSense:
+        {
+            return m_data->sense;
+        }
+        case GRB_IntAttr_Status:
+        {
+            return m_data->status;
+        }
+        case GRB_IntAttr_SolCount:
+        {
+            return m_data->has_solution ? 1 : 0;
+        }
+        case GRB_IntAttr_NumVars:
+        {
+            return m_data->highs.getNumCol();
+        }
+        case GRB_IntAttr_NumConstrs:
+        {
+            return m_data->highs.getNumRow();
+        }
+    }
+    throw createLogicError("Unsupported model attribute");
+}
+
+double GRBModel::get(GRB_DoubleAttr attribute) const
+{
+    if(attribute != GRB_DoubleAttr_ObjVal)
+    {
+        throw createLogicError("Unsupported model attribute");
+    }
+    if(!m_data->has_solution)
+    {
+        throw createLogicError("No solution is available");
+    }
+    return m_data->highs.getInfo().objective_function_value;
+}
+
+void GRBModel::set(GRB_IntAttr attribute, int value)
+{
+    if(attribute != GRB_IntAttr_ModelSense)
+    {
+        throw createLogicError("Unsupported model attribute");
+    }
+    m_data->sense = value;
+}
+
+void GRBModel::set(GRB_IntParam parameter, int value)
+{
+    grstapse::highs_backend::setParameter(m_data->parameters, parameter, value);
+}
+
+void GRBModel::set(GRB_DoubleParam parameter, double value)
+{
+    grstapse::highs_backend::setParameter(m_data->parameters, parameter, value);
+}
+
+void GRBModel::update()
+{
+    // Modifications are applied immediately
+}
+
+void GRBModel::reset()
+{
+    m_data->highs.clearSolver();
+    m_data->status       = GRB_LOADED;
+    m_data->has_solution = false;
+}
+
+void GRBModel::optimize()
+{
+    using Clock = std::chrono::steady_clock;
+
+    const grstapse::highs_backend::Parameters& parameters = m_data->parameters;
+    Highs& highs                                           = m_data->highs;
+    highs.setOptionValue("output_flag", parameters.log_to_console);
+    highs.setOptionValue("mip_rel_gap", parameters.mip_gap);
+    highs.setOptionValue("mip_heuristic_effort", parameters.heuristics);
+    highs.setOptionValue("solver", parameters.method == 2 ? "ipm" : (parameters.method >= 0 ? "simplex" : "choose"));
+    highs.changeObjectiveSense(m_data->sense == GRB_MAXIMIZE ? ObjSense::kMaximize : ObjSense::kMinimize);
+
+    const Clock::time_point start_time = Clock::now();
+    auto remaining_time                = [&parameters, start_time]() -> double
+    {
+        if(parameters.time_limit >= GRB_INFINITY)
+        {
+            return GRB_INFINITY;
+        }
+        return parameters.time_limit - std::chrono::duration<double>(Clock::now() - start_time).count();
+    };
+
+    if(m_data->objectives.empty())
+    {
+        // Use the objective coefficients from addVar
+        solve(remaining_time(), true);
+        return;
+    }
+
+    // Objectives with the same priority are summed; the highest priority is optimized first
+    std::map<int, GRBLinExpr, std::greater<>> levels;
+    for(const auto& [index, priority, expr]: m_data->objectives)
+    {
+        levels[priority] += expr;
+    }
+
+    std::vector<int> temporary_rows;
+    for(auto iter = levels.begin(); iter != levels.end(); ++iter)
+    {
+        setCosts(iter->second);
+        solve(remaining_time(), iter == levels.begin());
+        if(m_data->status != GRB_OPTIMAL || std::next(iter) == levels.end())
+        {
+            break;
+        }
+
+        // Keep this objective at its optimal value while optimizing the lower priority ones
+        const double optimum   = highs.getInfo().objective_function_value;
+        const double tolerance = 1e-6 * (1.0 + std::abs(optimum));
+        temporary_rows.push_back(addRow(m_data->sense == GRB_MAXIMIZE
+                                            ? GRBTempConstr(iter->second, GRB_GREATER_EQUAL, optimum - tolerance)
+                                            : GRBTempConstr(iter->second, GRB_LESS_EQUAL, optimum + tolerance)));
+    }
+
+    for(auto iter = temporary_rows.rbegin(); iter != temporary_rows.rend(); ++iter)
+    {
+        highs.deleteRows(*iter, *iter);
+        m_data->row_senses.erase(m_data->row_senses.begin() + *iter);
+    }
+}
+
+void GRBModel::solve(double time_limit, bool use_start)
+{
+    using Clock = std::chrono::steady_clock;
+
+    m_data->status       = GRB_LOADED;
+    m_data->has_solution = false;
+    if(time_limit <= 0.0)
+    {
+        m_data->status = GRB_TIME_LIMIT;
+        return;
+    }
+
+    Highs& highs = m_data->highs;
+    if(use_start)
+    {
+        std::vector<HighsInt> indices;
+        std::vector<double> values;
+        for(unsigned int i = 0; i < m_data->start.size(); ++i)
+        {
+            if(m_data->start[i] != GRB_UNDEFINED)
+            {
+                indices.push_back(i);
+                values.push_back(m_data->start[i]);
+            }
+        }
+        if(!indices.empty())
+        {
+            highs.setSolution(static_cast<HighsInt>(indices.size()), indices.data(), values.data());
+        }
+    }
+
+    const Clock::time_point start_time = Clock::now();
+    while(true)
+    {
+        if(time_limit < GRB_INFINITY)
+        {
+            const double remaining = time_limit - std::chrono::duration<double>(Clock::now() - start_time).count();
+            if(remaining <= 0.0)
+            {
+                m_data->status = GRB_TIME_LIMIT;
+                return;
+            }
+            highs.setOptionValue("time_limit", remaining);
+        }
+        else
+        {
+            highs.setOptionValue("time_limit", kHighsInf);
+        }
+
+        if(highs.run() == HighsStatus::kError)
+        {
+            throw createLogicError("HiGHS returned an error while solving the model");
+        }
+        m_data->status       = grstapse::highs_backend::convertStatus(highs, highs.getModelStatus());
+        m_data->solution     = highs.getSolution();
+        m_data->has_solution = highs.getInfo().primal_solution_status == kSolutionStatusFeasible;
+
+        // Any incumbent (including one from a non-optimal stop) is only accepted once it satisfies every lazy
+        // constraint
+        if(!m_data->has_solution || m_data->callback == nullptr || !m_data->parameters.lazy_constraints)
+        {
+            return;
+        }
+        bool added = false;
+        for(const GRBTempConstr& constraint: m_data->callback->run(m_data->solution.col_value))
+        {
+            if(constraint.violated(m_data->solution.col_value, grstapse::highs_backend::k_lazy_tolerance))
+            {
+                addRow(constraint);
+                added = true;
+            }
+        }
+        if(m_data->callback->m_aborted)
+        {
+            m_data->status       = GRB_INTERRUPTED;
+            m_data->has_solution = false;
+            return;
+        }
+        if(!added)
+        {
+            return;
+        }
+
+        // The incumbent violates a lazy constraint, so there is no solution unless the re-solve finds one
+        m_data->has_solution = false;
+    }
+}
+#endif
\ No newline at end of file
@@ -22,11 +22,14 @@
  */
 #include "grstapse/common/milp/milp_solver_base.hpp"
 
+// Global
+#include <algorithm>
 // Local
 #include "grstapse/common/milp/milp_infeasible.hpp"
 #include "grstapse/common/milp/milp_solver_result.hpp"
 #include "grstapse/common/milp/milp_timeout.hpp"
 #include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/deadline.hpp"
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/failure_reason.hpp"
 #include "grstapse/common/utilities/logger.hpp"
@@ -34,25 +37,31 @@
 
 namespace grstapse
 {
-    std::mutex MilpSolverBase::s_environment_lock          = std::mutex();
-    std::vector<GRBEnv> MilpSolverBase::s_environment_pool = std::vector<GRBEnv>();
-    std::vector<bool> MilpSolverBase::s_environment_taken  = std::vector<bool>();
+    std::mutex MilpSolverBase::s_environment_lock                           = std::mutex();
+    std::vector<std::unique_ptr<GRBEnv>> MilpSolverBase::s_environment_pool = std::vector<std::unique_ptr<GRBEnv>>();
+    std::vector<bool> MilpSolverBase::s_environment_taken                   = std::vector<bool>();
+    bool MilpSolverBase::s_clear_environments_on_release                    = false;
+    MilpSolverBase::EnvironmentParameters MilpSolverBase::s_environment_parameters =
+        MilpSolverBase::EnvironmentParameters();
 
     MilpSolverBase::MilpSolverBase(bool benders_decomposition)
         : m_return_feasible_on_timeout(false)
         , m_benders_decomposition(benders_decomposition)
         , m_benders_callback(nullptr)
+        , m_deadline(nullptr)
+        , m_deadline_callback(nullptr)
+        , m_time_limit(GRB_INFINITY)
         , m_num_iterations(0)
         , m_environment_index(-1)
     {}
 
     MilpSolverBase::~MilpSolverBase()
     {
-        std::lock_guard<std::mutex> lock(s_environment_lock);
-        if(m_environment_index >= 0)
-        {
-            s_environment_taken[m_environment_index] = false;
-        }
+        // The callbacks and model reference the environment, so they must be destroyed before it is released
+        m_benders_callback.reset();
+        m_deadline_callback.reset();
+        m_model.reset();
+        releaseEnvironment();
     }
 
     std::shared_ptr<MilpSolverResult> MilpSolverBase::solveMilp(const std::shared_ptr<const ParametersBase>& parameters)
@@ -67,6 +76,11 @@ namespace grstapse
             m_benders_callback = std::make_unique<BendersCallback>(this, m_model);
             m_model->setCallback(m_benders_callback.get());
         }
+        else if(m_deadline)
+        {
+            m_deadline_callback = std::make_unique<DeadlineCallback>(m_deadline);
+            m_model->setCallback(m_deadline_callback.get());
+        }
 
         while(true)
         {
@@ -106,6 +120,20 @@ namespace grstapse
     std::shared_ptr<MilpSolverResult> MilpSolverBase::resolve(const std::shared_ptr<MilpSolverResult>& result,
                                                               bool reset)
     {
+        if(m_deadline)
+        {
+            if(m_deadline->expired())
+            {
+                Logger::warn("Optimization skipped as the deadline has expired");
+                return std::make_shared<MilpSolverResult>(std::make_shared<MilpTimeout>(), result->numIterations());
+            }
+            if(m_deadline->isSet())
+            {
+                m_model->set(GRB_DoubleParam_TimeLimit,
+                             std::min(m_time_limit, static_cast<double>(m_deadline->remaining())));
+            }
+        }
+
         if(reset)
         {
             m_model->reset();
@@ -130,6 +158,7 @@ namespace grstapse
                 return std::make_shared<MilpSolverResult>(std::make_shared<MilpInfeasible>(), result->numIterations());
             }
             case GRB_TIME_LIMIT:
+            case GRB_INTERRUPTED:
             {
                 if(m_return_feasible_on_timeout)
                 {
@@ -191,6 +220,7 @@ namespace grstapse
         }
 
         m_model->update();
+        setStartValues(*m_model);
         return std::make_shared<MilpSolverResult>(m_model);
     }
 
@@ -199,6 +229,11 @@ namespace grstapse
         return UpdateModelResult(UpdateModelResultType::e_no_update);
     }
 
+    void MilpSolverBase::setStartValues(GRBModel& model)
+    {
+        // Default is blank
+    }
+
     void MilpSolverBase::makeCuts(BendersCallback& callback)
     {
         // Default is blank
@@ -213,10 +248,11 @@ namespace grstapse
             model.set(GRB_IntParam_PoolSolutions, 1);  // Only need one
         }
 
+        m_time_limit = s_environment_parameters.time_limit < 0.0 ? GRB_INFINITY : s_environment_parameters.time_limit;
         if(parameters->contains(constants::k_milp_timeout) && parameters->get<float>(constants::k_milp_timeout) > 0.0f)
         {
-            model.set(GRB_DoubleParam_TimeLimit,
-                      static_cast<double>(parameters->get<float>(constants::k_milp_timeout)));
+            m_time_limit = static_cast<double>(parameters->get<float>(constants::k_milp_timeout));
+            model.set(GRB_DoubleParam_TimeLimit, m_time_limit);
         }
 
         if(parameters->contains(constants::k_mip_gap) && parameters->get<float>(constants::k_mip_gap) > 0.0f)
@@ -236,6 +272,11 @@ namespace grstapse
             model.set(GRB_IntParam_Method, parameters->get<int>(constants::k_method));
         }
 
+        if(parameters->contains(constants::k_threads) && parameters->get<unsigned int>(constants::k_threads) > 0)
+        {
+            model.set(GRB_IntParam_Threads, static_cast<int>(parameters->get<unsigned int>(constants::k_threads)));
+        }
+
         if(m_benders_decomposition)
         {
             model.set(GRB_IntParam_LazyConstraints, 1);
@@ -245,47 +286,145 @@ namespace grstapse
     GRBEnv& MilpSolverBase::getEnvironment()
     {
         std::lock_guard<std::mutex> lock(s_environment_lock);
-        if(s_environment_pool.empty())
-        {
-            GRBEnv& env = s_environment_pool.emplace_back(true);
-            env.set(GRB_IntParam_LogToConsole, 0);
-            env.start();
-        }
-        return s_environment_pool.front();
-        //        // Find the first untaken environment
-        //        for(unsigned int i = 0; i < s_environment_taken.size(); ++i)
-        //        {
-        //            if(not s_environment_taken[i])
-        //            {
-        //                m_environment_index    = i;
-        //                s_environment_taken[i] = true;
-        //                return s_environment_pool[i];
-        //            }
-        //        }
-        //
-        //        m_environment_index = s_environment_taken.size();
-        //        s_environment_taken.emplace_back(true);
-        //
-        //        GRBEnv& env = s_environment_pool.emplace_back(true);
-        //        env.set(GRB_IntParam_LogToConsole, 0);
-        //        env.start();
-        //        return env;
+        if(m_environment_index >= 0)
+        {
+            // Already checked out by this solver
+            return *s_environment_pool[m_environment_index];
+        }
+
+        // Find the first untaken environment (preferring one that has already been started)
+        int empty_index = -1;
+        for(unsigned int i = 0; i < s_environment_taken.size(); ++i)
+        {
+            if(s_environment_taken[i])
+            {
+                continue;
+            }
+            if(s_environment_pool[i])
+            {
+                m_environment_index    = i;
+                s_environment_taken[i] = true;
+                return *s_environment_pool[i];
+            }
+            if(empty_index < 0)
+            {
+                empty_index = i;
+            }
+        }
+
+        if(empty_index < 0)
+        {
+            empty_index = s_environment_taken.size();
+            s_environment_taken.push_back(false);
+            s_environment_pool.emplace_back(nullptr);
+        }
+
+        auto env = std::make_unique<GRBEnv>(true);
+        env->set(GRB_IntParam_LogToConsole, 0);
+        configureEnvironment(*env);
+        env->start();
+
+        m_environment_index              = empty_index;
+        s_environment_taken[empty_index] = true;
+        s_environment_pool[empty_index]  = std::move(env);
+        return *s_environment_pool[empty_index];
+    }
+
+    void MilpSolverBase::releaseEnvironment()
+    {
+        std::lock_guard<std::mutex> lock(s_environment_lock);
+        if(m_environment_index < 0)
+        {
+            return;
+        }
+
+        // Destroy the environment instead of pooling it if a clear was requested while it was checked out or the
+        // pool already holds the maximum number of idle environments
+        const auto index      = static_cast<unsigned int>(m_environment_index);
+        unsigned int num_idle = 0;
+        for(unsigned int i = 0; i < s_environment_pool.size(); ++i)
+        {
+            if(i != index && not s_environment_taken[i] && s_environment_pool[i])
+            {
+                ++num_idle;
+            }
+        }
+        if(s_clear_environments_on_release || num_idle >= s_environment_parameters.max_idle_environments)
+        {
+            s_environment_pool[index].reset();
+        }
+        s_environment_taken[index] = false;
+        m_environment_index        = -1;
+
+        if(std::none_of(s_environment_taken.begin(),
+                        s_environment_taken.end(),
+                        [](bool b) -> bool
+                        {
+                            return b;
+                        }))
+        {
+            s_clear_environments_on_release = false;
+        }
+        shrinkEnvironmentPool();
+    }
+
+    void MilpSolverBase::shrinkEnvironmentPool()
+    {
+        // Trailing slots that are neither taken nor hold an environment can be dropped
+        while(not s_environment_pool.empty() && not s_environment_taken.back() && not s_environment_pool.back())
+        {
+            s_environment_pool.pop_back();
+            s_environment_taken.pop_back();
+        }
+    }
+
+    void MilpSolverBase::configureEnvironment(GRBEnv& env)
+    {
+        env.set(GRB_IntParam_Threads, s_environment_parameters.threads);
+        env.set(GRB_DoubleParam_TimeLimit,
+                s_environment_parameters.time_limit < 0.0 ? GRB_INFINITY : s_environment_parameters.time_limit);
+    }
+
+    void MilpSolverBase::setEnvironmentParameters(const EnvironmentParameters& parameters)
+    {
+        std::lock_guard<std::mutex> lock(s_environment_lock);
+        s_environment_parameters = parameters;
+        for(std::unique_ptr<GRBEnv>& env: s_environment_pool)
+        {
+            if(env)
+            {
+                configureEnvironment(*env);
+            }
+        }
+    }
+
+    unsigned int MilpSolverBase::numberOfEnvironments()
+    {
+        std::lock_guard<std::mutex> lock(s_environment_lock);
+        return std::count_if(s_environment_pool.begin(),
+                             s_environment_pool.end(),
+                             [](const std::unique_ptr<GRBEnv>& env) -> bool
+                             {
+                                 return env != nullptr;
+                             });
     }
 
-    void MilpSolverBase::clearEnvironments()
+    void MilpSolverBase::clearEnvironments() noexcept
     {
         std::lock_guard<std::mutex> lock(s_environment_lock);
-        if(std::any_of(s_environment_taken.begin(),
-                       s_environment_taken.end(),
-                       [](bool b) -> bool  // Hopefully the compiler is smart about this...
-                       {
-                           return b;
-                       }))
+        // Environments that are still checked out are destroyed when their solver releases them
+        for(unsigned int i = 0; i < s_environment_pool.size(); ++i)
         {
-            throw createLogicError("Attempting to clear gurobi environments while some are still in use");
+            if(s_environment_taken[i])
+            {
+                s_clear_environments_on_release = true;
+            }
+            else
+            {
+                s_environment_pool[i].reset();
+            }
         }
-        s_environment_pool.clear();
-        s_environment_taken.clear();
+        shrinkEnvironmentPool();
     }
 
     MilpSolverBase::BendersCallback::BendersCallback(MilpSolverBase* milp_solver,
@@ -294,19 +433,42 @@ namespace grstapse
         , m_model(model)
     {}
 
+    void MilpSolverBase::setDeadline(const std::shared_ptr<const Deadline>& deadline)
+    {
+        m_deadline = deadline;
+    }
+
     void MilpSolverBase::BendersCallback::callback()
     {
+        if(m_milp_solver->m_deadline && m_milp_solver->m_deadline->expired())
+        {
+            abort();
+            return;
+        }
         if(where == GRB_CB_MIPSOL)
         {
             m_milp_solver->makeCuts(*this);
         }
     }
 
+    MilpSolverBase::DeadlineCallback::DeadlineCallback(const std::shared_ptr<const Deadline>& deadline)
+        : m_deadline(deadline)
+    {}
+
+    void MilpSolverBase::DeadlineCallback::callback()
+    {
+        if(m_deadline->expired())
+        {
+            abort();
+        }
+    }
+
     void MilpSolverBase::checkEnvironmentErrors()
     {
-        for(GRBEnv& env: s_environment_pool)
+        std::lock_guard<std::mutex> lock(s_environment_lock);
+        for(std::unique_ptr<GRBEnv>& env: s_environment_pool)
         {
-            Logger::warn(env.getErrorMsg());
+            Logger::warn(env->getErrorMsg());
         }
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/common/search/search_node_arena.hpp"
+
+// Global
+#include <algorithm>
+#include <new>
+
+namespace grstapse
+{
+    std::atomic<std::uint64_t> SearchNodeArena::s_next_arena_id = 1;
+    thread_local SearchNodeArena::ThreadCache SearchNodeArena::s_thread_cache;
+
+    SearchNodeArena::SearchNodeArena(std::size_t chunk_size)
+        : m_id(s_next_arena_id.fetch_add(1, std::memory_order_relaxed))
+        , m_chunk_size(std::max(chunk_size, k_max_pooled_size))
+        , m_free_lists{}
+        , m_num_free(0)
+        , m_next_id(0)
+    {}
+
+    void* SearchNodeArena::allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if(!isPooled(bytes, alignment))
+        {
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+
+        // A thread that moves on to another arena abandons the rest of its chunk and free lists in the previous one
+        ThreadCache& cache = s_thread_cache;
+        if(cache.arena_id != m_id)
+        {
+            cache = ThreadCache{.arena_id = m_id};
+        }
+
+        const std::size_t size_class = sizeClass(bytes);
+        if(FreeBlock* block = cache.free_lists[size_class]; block != nullptr)
+        {
+            cache.free_lists[size_class] = block->next;
+            return block;
+        }
+
+        const std::size_t size = (size_class + 1) * k_granularity;
+        if(m_num_free.load(std::memory_order_relaxed) > 0 || cache.remaining < size)
+        {
+            std::lock_guard lock(m_mutex);
+            if(FreeBlock* block = m_free_lists[size_class]; block != nullptr)
+            {
+                m_free_lists[size_class] = block->next;
+                m_num_free.fetch_sub(1, std::memory_order_relaxed);
+                return block;
+            }
+            if(cache.remaining < size)
+            {
+                // Chunks from new[] are aligned to at least k_granularity, and every size class is a multiple of it
+                m_chunks.push_back(std::make_unique_for_overwrite<std::byte[]>(m_chunk_size));
+                cache.cursor    = m_chunks.back().get();
+                cache.remaining = m_chunk_size;
+            }
+        }
+
+        void* ptr = cache.cursor;
+        cache.cursor += size;
+        cache.remaining -= size;
+        return ptr;
+    }
+
+    void SearchNodeArena::deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept
+    {
+        if(!isPooled(bytes, alignment))
+        {
+            ::operator delete(ptr, std::align_val_t(alignment));
+            return;
+        }
+
+        const std::size_t size_class = sizeClass(bytes);
+        FreeBlock* block             = ::new(ptr) FreeBlock{nullptr};
+        if(ThreadCache& cache = s_thread_cache; cache.arena_id == m_id)
+        {
+            block->next                  = cache.free_lists[size_class];
+            cache.free_lists[size_class] = block;
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        block->next              = m_free_lists[size_class];
+        m_free_lists[size_class] = block;
+        m_num_free.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t SearchNodeArena::numberOfChunks() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_chunks.size();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/common/utilities/deadline.hpp"
+
+// Global
+#include <limits>
+
+namespace grstapse
+{
+    Deadline::Deadline()
+        : m_time_point(std::chrono::steady_clock::time_point::max())
+        , m_cancelled(false)
+    {}
+
+    void Deadline::start(float seconds)
+    {
+        if(seconds == std::numeric_limits<float>::infinity())
+        {
+            clear();
+            return;
+        }
+        m_time_point = std::chrono::steady_clock::now() +
+                       std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                           std::chrono::duration<float>(seconds));
+        m_cancelled.store(false, std::memory_order_relaxed);
+    }
+
+    void Deadline::clear()
+    {
+        m_time_point = std::chrono::steady_clock::time_point::max();
+        m_cancelled.store(false, std::memory_order_relaxed);
+    }
+
+    void Deadline::cancel()
+    {
+        m_cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    float Deadline::remaining() const
+    {
+        if(cancelled())
+        {
+            return 0.0f;
+        }
+        if(!isSet())
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+        const float seconds =
+            std::chrono::duration<float>(m_time_point - std::chrono::steady_clock::now()).count();
+        return seconds > 0.0f ? seconds : 0.0f;
+    }
+}  // namespace grstapse
\ No newline at end of file
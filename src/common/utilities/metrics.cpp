@@ -0,0 +1,363 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/common/utilities/metrics.hpp"
+
+// Global
+#include <chrono>
+// External
+#include <fmt/format.h>
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! Process wide mapping between metric names and identifiers
+        struct MetricRegistry
+        {
+            std::mutex mutex;
+            robin_hood::unordered_map<std::string, MetricId> ids;
+            std::vector<std::string> names;
+        };
+
+        MetricRegistry& registry()
+        {
+            static MetricRegistry singleton;
+            return singleton;
+        }
+
+        //! A recently used accumulator of the calling thread
+        struct AccumulatorCacheEntry
+        {
+            std::uint64_t serial = 0;  //!< 0 is never used by a Metrics
+            void* accumulator    = nullptr;
+        };
+
+        constexpr unsigned int k_accumulator_cache_size = 4;
+
+        std::atomic<std::uint64_t> s_next_serial = 1;
+        thread_local std::array<AccumulatorCacheEntry, k_accumulator_cache_size> t_accumulator_cache;
+        thread_local unsigned int t_next_cache_entry = 0;
+        thread_local Metrics* t_current              = nullptr;
+
+        [[nodiscard]] std::int64_t now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+    }  // namespace
+
+    Metrics::Metrics()
+        : m_serial(s_next_serial++)
+    {}
+
+    MetricId Metrics::intern(std::string_view name)
+    {
+        MetricRegistry& r = registry();
+        std::lock_guard lock(r.mutex);
+        if(auto iter = r.ids.find(std::string(name)); iter != r.ids.end())
+        {
+            return iter->second;
+        }
+        const MetricId id = static_cast<MetricId>(r.names.size());
+        r.names.emplace_back(name);
+        r.ids.emplace(r.names.back(), id);
+        return id;
+    }
+
+    std::optional<MetricId> Metrics::find(std::string_view name)
+    {
+        MetricRegistry& r = registry();
+        std::lock_guard lock(r.mutex);
+        if(auto iter = r.ids.find(std::string(name)); iter != r.ids.end())
+        {
+            return iter->second;
+        }
+        return std::nullopt;
+    }
+
+    std::string Metrics::name(MetricId id)
+    {
+        MetricRegistry& r = registry();
+        std::lock_guard lock(r.mutex);
+        if(id >= r.names.size())
+        {
+            throw createLogicError(fmt::format("Unknown metric identifier '{0:d}'", id));
+        }
+        return r.names[id];
+    }
+
+    Metrics& Metrics::current()
+    {
+        return t_current != nullptr ? *t_current : global();
+    }
+
+    Metrics& Metrics::global()
+    {
+        static Metrics singleton;
+        return singleton;
+    }
+
+    void Metrics::increment(MetricId id, double amount)
+    {
+        // fetch_add so that a concurrent reset or remove is never lost
+        Block& block         = localBlock(id);
+        const unsigned int i = id % k_block_size;
+        block.values[i].fetch_add(amount, std::memory_order_relaxed);
+        block.recorded[i].store(true, std::memory_order_relaxed);
+    }
+
+    void Metrics::startTimer(MetricId id)
+    {
+        Block& block         = localBlock(id);
+        const unsigned int i = id % k_block_size;
+        if(block.timer_depths[i]++ == 0)
+        {
+            block.timer_starts[i].store(now(), std::memory_order_relaxed);
+        }
+    }
+
+    void Metrics::stopTimer(MetricId id)
+    {
+        Block& block         = localBlock(id);
+        const unsigned int i = id % k_block_size;
+        if(block.timer_depths[i] == 0)
+        {
+            throw createLogicError(fmt::format("Timer '{0:s}' is not running", name(id)));
+        }
+        if(--block.timer_depths[i] == 0)
+        {
+            const std::int64_t start = block.timer_starts[i].exchange(k_not_running, std::memory_order_relaxed);
+            increment(id, static_cast<double>(now() - start) * 1e-9);
+        }
+    }
+
+    double Metrics::value(MetricId id) const
+    {
+        const std::int64_t time = now();
+        const unsigned int i    = id % k_block_size;
+        double rv               = 0.0;
+        std::lock_guard lock(m_mutex);
+        for(const std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            const Block* block = findBlock(*accumulator, id);
+            if(block == nullptr)
+            {
+                continue;
+            }
+            rv += block->values[i].load(std::memory_order_relaxed);
+            if(const std::int64_t start = block->timer_starts[i].load(std::memory_order_relaxed);
+               start != k_not_running)
+            {
+                rv += static_cast<double>(time - start) * 1e-9;
+            }
+        }
+        return rv;
+    }
+
+    bool Metrics::contains(MetricId id) const
+    {
+        const unsigned int i = id % k_block_size;
+        std::lock_guard lock(m_mutex);
+        for(const std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            if(const Block* block = findBlock(*accumulator, id);
+               block != nullptr && (block->recorded[i].load(std::memory_order_relaxed) ||
+                                    block->timer_starts[i].load(std::memory_order_relaxed) != k_not_running))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Metrics::reset(MetricId id)
+    {
+        const unsigned int i = id % k_block_size;
+        std::lock_guard lock(m_mutex);
+        for(std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            if(Block* block = findBlock(*accumulator, id); block != nullptr)
+            {
+                block->values[i].exchange(0.0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Metrics::resetAll()
+    {
+        if(hasRunningTimers())
+        {
+            throw createLogicError("Cannot reset all metrics while there are still running timers");
+        }
+        std::lock_guard lock(m_mutex);
+        for(std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            for(Block& block: accumulator->blocks)
+            {
+                for(std::atomic<double>& value: block.values)
+                {
+                    value.exchange(0.0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    void Metrics::remove(MetricId id)
+    {
+        const unsigned int i = id % k_block_size;
+        std::lock_guard lock(m_mutex);
+        for(std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            if(Block* block = findBlock(*accumulator, id); block != nullptr)
+            {
+                block->values[i].exchange(0.0, std::memory_order_relaxed);
+                block->recorded[i].store(false, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Metrics::removeAll()
+    {
+        if(hasRunningTimers())
+        {
+            throw createLogicError("Cannot remove all metrics while there are still running timers");
+        }
+        std::lock_guard lock(m_mutex);
+        for(std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            for(Block& block: accumulator->blocks)
+            {
+                for(unsigned int i = 0; i < k_block_size; ++i)
+                {
+                    block.values[i].exchange(0.0, std::memory_order_relaxed);
+                    block.recorded[i].store(false, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    bool Metrics::hasRunningTimers() const
+    {
+        std::lock_guard lock(m_mutex);
+        for(const std::unique_ptr<Accumulator>& accumulator: m_accumulators)
+        {
+            for(const Block& block: accumulator->blocks)
+            {
+                for(const std::atomic<std::int64_t>& start: block.timer_starts)
+                {
+                    if(start.load(std::memory_order_relaxed) != k_not_running)
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    Metrics::Accumulator& Metrics::local()
+    {
+        for(const AccumulatorCacheEntry& entry: t_accumulator_cache)
+        {
+            if(entry.serial == m_serial)
+            {
+                return *static_cast<Accumulator*>(entry.accumulator);
+            }
+        }
+
+        // Not recently used by this thread, so find (or create) its accumulator
+        const std::thread::id owner = std::this_thread::get_id();
+        Accumulator* accumulator    = nullptr;
+        {
+            std::lock_guard lock(m_mutex);
+            for(std::unique_ptr<Accumulator>& a: m_accumulators)
+            {
+                if(a->owner == owner)
+                {
+                    accumulator = a.get();
+                    break;
+                }
+            }
+            if(accumulator == nullptr)
+            {
+                accumulator = m_accumulators.emplace_back(std::make_unique<Accumulator>(owner)).get();
+            }
+        }
+
+        t_accumulator_cache[t_next_cache_entry] = {.serial = m_serial, .accumulator = accumulator};
+        t_next_cache_entry                      = (t_next_cache_entry + 1) % k_accumulator_cache_size;
+        return *accumulator;
+    }
+
+    Metrics::Block& Metrics::localBlock(MetricId id)
+    {
+        Accumulator& accumulator = local();
+        const std::size_t index  = id / k_block_size;
+        // Only the owner adds blocks, so it can check the size without the lock
+        if(index >= accumulator.blocks.size())
+        {
+            std::lock_guard lock(m_mutex);
+            while(index >= accumulator.blocks.size())
+            {
+                accumulator.blocks.emplace_back();
+            }
+        }
+        return accumulator.blocks[index];
+    }
+
+    Metrics::Block* Metrics::findBlock(Accumulator& accumulator, MetricId id)
+    {
+        const std::size_t index = id / k_block_size;
+        return index < accumulator.blocks.size() ? &accumulator.blocks[index] : nullptr;
+    }
+
+    Metrics::Accumulator::Accumulator(std::thread::id owner)
+        : owner(owner)
+    {}
+
+    Metrics::Block::Block()
+    {
+        for(unsigned int i = 0; i < k_block_size; ++i)
+        {
+            values[i].store(0.0, std::memory_order_relaxed);
+            timer_starts[i].store(k_not_running, std::memory_order_relaxed);
+            timer_depths[i] = 0;
+            recorded[i].store(false, std::memory_order_relaxed);
+        }
+    }
+
+    Metrics::Activation::Activation(Metrics& metrics)
+        : m_previous(t_current)
+    {
+        t_current = &metrics;
+    }
+
+    Metrics::Activation::~Activation()
+    {
+        t_current = m_previous;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -22,9 +22,10 @@
  */
 #include "grstapse/common/utilities/time_keeper.hpp"
 
+// External
+#include <fmt/format.h>
 // Local
 #include "grstapse/common/utilities/error.hpp"
-#include "grstapse/common/utilities/logger.hpp"
 
 namespace grstapse
 {
@@ -34,110 +35,48 @@ namespace grstapse
         return singleton;
     }
 
-    void TimeKeeper::setActive(const std::string& timer_name, Timer* timer)
-    {
-        if(m_currently_active_timers.contains(timer_name))
-        {
-            auto [first, last] = m_currently_active_timers.equal_range(timer_name);
-            for(auto iter = first; iter != last; ++iter)
-            {
-                if(timer == iter->second)
-                {
-                    Logger::warn("Timer '{0:s}' already active", timer_name);
-                    return;
-                }
-            }
-        }
-
-        m_currently_active_timers.emplace(timer_name, timer);
-    }
-
-    void TimeKeeper::setInactive(const std::string& timer_name, Timer* timer)
-    {
-        if(m_currently_active_timers.contains(timer_name))
-        {
-            auto [first, last] = m_currently_active_timers.equal_range(timer_name);
-            for(auto iter = first; iter != last; ++iter)
-            {
-                if(timer == iter->second)
-                {
-                    m_currently_active_timers.erase(iter);
-                    return;
-                }
-            }
-        }
-
-        Logger::warn("Timer '{0:s}' not active", timer_name);
-    }
-
     void TimeKeeper::reset(const std::string& timer_name)
     {
-        if(not m_times.contains(timer_name))
-        {
-            throw createLogicError(fmt::format("Request for reset of unknown timer '{0:s}'", timer_name));
-        }
-        m_times[timer_name] = 0;
+        Metrics::current().reset(recordedId(timer_name, "reset of"));
     }
 
     void TimeKeeper::resetAll()
     {
-        if(not m_currently_active_timers.empty())
-        {
-            throw createLogicError("Cannot reset all recorded times while there are still active timers");
-        }
-        for(auto& [name, timer]: m_times)
-        {
-            timer = 0;
-        }
+        Metrics::current().resetAll();
     }
 
     void TimeKeeper::remove(const std::string& timer_name)
     {
-        if(not m_times.contains(timer_name))
-        {
-            throw createLogicError(fmt::format("Request for removal of unknown timer '{0:s}'", timer_name));
-        }
-        m_times.erase(timer_name);
+        Metrics::current().remove(recordedId(timer_name, "removal of"));
     }
 
     void TimeKeeper::removeAll()
     {
-        if(not m_currently_active_timers.empty())
-        {
-            throw createLogicError("Cannot remove all recorded times while there are still active timers");
-        }
-        m_times.clear();
+        Metrics::current().removeAll();
     }
 
     float TimeKeeper::time(const std::string& timer_name) const
     {
-        if(not m_times.contains(timer_name) and not m_currently_active_timers.contains(timer_name))
-        {
-            throw createLogicError(fmt::format("Request for time from unknown timer '{0:s}'", timer_name));
-        }
-        float rv = 0.0;
-        if(m_times.contains(timer_name))
-        {
-            rv += m_times.at(timer_name);
-        }
-        if(m_currently_active_timers.contains(timer_name))
-        {
-            auto [first, last] = m_currently_active_timers.equal_range(timer_name);
-            for(auto iter = first; iter != last; ++iter)
-            {
-                rv += iter->second->get();
-            }
-        }
-        return rv;
+        return time(recordedId(timer_name, "time from"));
+    }
+
+    float TimeKeeper::time(MetricId timer_id) const
+    {
+        return static_cast<float>(Metrics::current().value(timer_id));
     }
 
     void TimeKeeper::increment(const std::string& timer_name, float amount)
     {
-        if(not m_times.contains(timer_name))
+        Metrics::current().increment(Metrics::intern(timer_name), amount);
+    }
+
+    MetricId TimeKeeper::recordedId(const std::string& timer_name, const char* request)
+    {
+        if(std::optional<MetricId> id = Metrics::find(timer_name); id && Metrics::current().contains(*id))
         {
-            m_times[timer_name] = 0;
+            return *id;
         }
-        m_times[timer_name] += amount;
+        throw createLogicError(fmt::format("Request for {0:s} unknown timer '{1:s}'", request, timer_name));
     }
 
 }  // namespace grstapse
\ No newline at end of file
@@ -22,24 +22,21 @@
  */
 #include "grstapse/common/utilities/timer_runner.hpp"
 
-// Local
-#include "grstapse/common/utilities/error.hpp"
-#include "grstapse/common/utilities/logger.hpp"
-#include "grstapse/common/utilities/time_keeper.hpp"
-
 namespace grstapse
 {
     TimerRunner::TimerRunner(const std::string& name)
-        : m_name(name)
+        : TimerRunner(Metrics::intern(name))
+    {}
+
+    TimerRunner::TimerRunner(MetricId id)
+        : m_metrics(&Metrics::current())
+        , m_id(id)
     {
-        TimeKeeper::instance().setActive(name, &m_timer);
-        m_timer.start();
+        m_metrics->startTimer(m_id);
     }
 
     TimerRunner::~TimerRunner()
     {
-        m_timer.stop();
-        TimeKeeper::instance().increment(m_name, m_timer.get());
-        TimeKeeper::instance().setInactive(m_name, &m_timer);
+        m_metrics->stopTimer(m_id);
     }
 }  // namespace grstapse
\ No newline at end of file
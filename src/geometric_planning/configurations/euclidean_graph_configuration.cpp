@@ -22,6 +22,8 @@
  */
 #include "grstapse/geometric_planning/configurations/euclidean_graph_configuration.hpp"
 
+// External
+#include <boost/functional/hash.hpp>
 // Local
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/common/utilities/error.hpp"
@@ -101,6 +103,15 @@ namespace grstapse
         return m_id == rhs.m_id && m_x == rhs.m_x && m_y == rhs.m_y;
     }
 
+    std::size_t EuclideanGraphConfiguration::hash() const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, m_id);
+        boost::hash_combine(seed, m_x);
+        boost::hash_combine(seed, m_y);
+        return seed;
+    }
+
     void to_json(nlohmann::json& j, const EuclideanGraphConfiguration& c)
     {
         j[grstapse::constants::k_configuration_type] = c.configurationType();
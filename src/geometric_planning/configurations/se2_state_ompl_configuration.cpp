@@ -25,6 +25,7 @@
 // Global
 #include <cmath>
 // External
+#include <boost/functional/hash.hpp>
 #include <ompl/base/ScopedState.h>
 #include <ompl/base/goals/GoalState.h>
 #include <ompl/base/spaces/SE2StateSpace.h>
@@ -70,6 +71,15 @@ namespace grstapse
         return m_x == rhs.m_x && m_y == rhs.m_y && m_yaw == rhs.m_yaw;
     }
 
+    std::size_t Se2StateOmplConfiguration::hash() const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, m_x);
+        boost::hash_combine(seed, m_y);
+        boost::hash_combine(seed, m_yaw);
+        return seed;
+    }
+
     float Se2StateOmplConfiguration::euclideanDistance(const ConfigurationBase& rhs) const
     {
         if(m_configuration_type != rhs.configurationType())
@@ -23,6 +23,7 @@
 #include "grstapse/geometric_planning/configurations/se3_state_ompl_configuration.hpp"
 
 // External
+#include <boost/functional/hash.hpp>
 #include <ompl/base/ScopedState.h>
 #include <ompl/base/goals/GoalState.h>
 #include <ompl/base/spaces/SE3StateSpace.h>
@@ -122,6 +123,19 @@ namespace grstapse
                m_qy == rhs.m_qy && m_qz == rhs.m_qz;
     }
 
+    std::size_t Se3StateOmplConfiguration::hash() const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, m_x);
+        boost::hash_combine(seed, m_y);
+        boost::hash_combine(seed, m_z);
+        boost::hash_combine(seed, m_qw);
+        boost::hash_combine(seed, m_qx);
+        boost::hash_combine(seed, m_qy);
+        boost::hash_combine(seed, m_qz);
+        return seed;
+    }
+
     ompl::base::ScopedStatePtr Se3StateOmplConfiguration::convertToScopedStatePtr(
         const ompl::base::StateSpacePtr& state_space) const
     {
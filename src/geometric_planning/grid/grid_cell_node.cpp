@@ -29,7 +29,7 @@
 
 namespace grstapse
 {
-    unsigned int GridCellNode::s_next_id = 0;
+    std::atomic<unsigned int> GridCellNode::s_next_id = 0;
 
     GridCellNode::GridCellNode(unsigned int x, unsigned int y, const std::shared_ptr<const GridCellNode>& parent)
         : GridCell(x, y)
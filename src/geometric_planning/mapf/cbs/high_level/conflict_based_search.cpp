@@ -23,6 +23,7 @@
 #include "grstapse/geometric_planning/mapf/cbs/conflict_based_search.hpp"
 
 // Local
+#include "grstapse/common/utilities/deadline.hpp"
 #include "grstapse/common/utilities/time_keeper.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/conflict_base.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node.hpp"
@@ -56,9 +57,13 @@ namespace grstapse
         const unsigned int num_robots = m_problem_inputs->numberOfRobots();
         const ConstraintTreeNodeCostType cost_type =
             m_parameters->get<ConstraintTreeNodeCostType>(constants::k_constraint_tree_node_cost_type);
-        const bool has_timeout       = Base_::m_parameters->template get<bool>(constants::k_has_timeout);
-        const std::string timer_name = Base_::m_parameters->template get<std::string>(constants::k_timer_name);
-        const float timeout          = Base_::m_parameters->template get<float>(constants::k_timeout);
+        Deadline deadline;
+        if(Base_::m_parameters->template get<bool>(constants::k_has_timeout))
+        {
+            const std::string timer_name = Base_::m_parameters->template get<std::string>(constants::k_timer_name);
+            const float timeout          = Base_::m_parameters->template get<float>(constants::k_timeout);
+            deadline.start(timeout - TimeKeeper::instance().time(timer_name));
+        }
 
         if(!computeLowLevelSolution(root))
         {
@@ -70,7 +75,7 @@ namespace grstapse
         while(!m_open.empty())
         {
             // Timed out
-            if(has_timeout && TimeKeeper::instance().time(timer_name) > timeout)
+            if(deadline.expired())
             {
                 Logger::warn("Search exceeded the timeout");
                 break;
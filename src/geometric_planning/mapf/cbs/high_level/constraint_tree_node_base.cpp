@@ -34,7 +34,7 @@
 
 namespace grstapse
 {
-    unsigned int ConstraintTreeNodeBase::s_next_id = 0;
+    std::atomic<unsigned int> ConstraintTreeNodeBase::s_next_id = 0;
 
     ConstraintTreeNodeBase::ConstraintTreeNodeBase(unsigned int num_robots,
                                                    ConstraintTreeNodeCostType cost,
@@ -29,7 +29,7 @@
 
 namespace grstapse
 {
-    unsigned int TemporalGridCellNode::s_next_id = 0;
+    std::atomic<unsigned int> TemporalGridCellNode::s_next_id = 0;
 
     TemporalGridCellNode::TemporalGridCellNode(unsigned int time,
                                                unsigned int x,
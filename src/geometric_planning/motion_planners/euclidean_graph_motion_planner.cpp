@@ -64,14 +64,16 @@ namespace grstapse
         auto ic = std::dynamic_pointer_cast<const EuclideanGraphConfiguration>(initial_configuration);
         auto gc = std::dynamic_pointer_cast<const EuclideanGraphConfiguration>(goal_configuration);
 
-        m_astar_functors.heuristic =
+        // Copied so that concurrent queries do not overwrite each other's heuristic and goal check
+        AStarFunctors<SearchNode> astar_functors = m_astar_functors;
+        astar_functors.heuristic =
             std::make_shared<const EuclideanGraphConfigurationEuclideanDistanceHeuristic<SearchNode>>(gc);
-        m_astar_functors.goal_check = std::make_shared<const EqualEuclideanGraphConfigurationGoalCheck<SearchNode>>(gc);
+        astar_functors.goal_check = std::make_shared<const EqualEuclideanGraphConfigurationGoalCheck<SearchNode>>(gc);
 
         EuclideanGraphAStar a_star(m_search_parameters,
                                    ic,
                                    std::dynamic_pointer_cast<EuclideanGraphEnvironment>(m_environment),
-                                   m_astar_functors);
+                                   astar_functors);
         auto result = a_star.search();
         if(!result.foundGoal())
         {
@@ -22,8 +22,14 @@
  */
 #include "grstapse/geometric_planning/motion_planners/motion_planner_base.hpp"
 
+// Global
+#include <chrono>
+#include <utility>
+// External
+#include <boost/functional/hash.hpp>
 // Local
 #include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/deadline.hpp"
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/json_extension.hpp"
 #include "grstapse/common/utilities/json_tree_factory.hpp"
@@ -44,14 +50,29 @@
 
 namespace grstapse
 {
-    unsigned int MotionPlannerBase::s_num_failures = 0;
+    const MetricId MotionPlannerBase::s_num_failures_id = Metrics::intern(constants::k_num_motion_plan_failures);
+    const MetricId MotionPlannerBase::s_motion_planning_time_id =
+        Metrics::intern(constants::k_motion_planning_time);
 
     MotionPlannerBase::MotionPlannerBase(const std::shared_ptr<const ParametersBase>& parameters,
                                          const std::shared_ptr<EnvironmentBase>& environment)
         : m_parameters(parameters)
         , m_environment(environment)
+        , m_deadline(nullptr)
+        , m_num_motion_plans(0)
     {}
 
+    MotionPlannerBase::DeadlineGuard::DeadlineGuard(MotionPlannerBase& motion_planner,
+                                                     const std::shared_ptr<const Deadline>& deadline)
+        : m_motion_planner(motion_planner)
+        , m_previous_deadline(std::exchange(motion_planner.m_deadline, deadline))
+    {}
+
+    MotionPlannerBase::DeadlineGuard::~DeadlineGuard()
+    {
+        m_motion_planner.m_deadline = std::move(m_previous_deadline);
+    }
+
     void MotionPlannerBase::init()
     {
         static bool first = true;
@@ -166,20 +187,53 @@ namespace grstapse
         const std::shared_ptr<const ConfigurationBase>& initial_configuration,
         const std::shared_ptr<const ConfigurationBase>& goal_configuration)
     {
-        std::lock_guard lock(m_mutex);
-        TimerRunner timer_runner(constants::k_motion_planning_time);
-        if(std::shared_ptr<const MotionPlannerQueryResultBase> result =
-               getMemoized(species, initial_configuration, goal_configuration);
-           result != nullptr)
+        TimerRunner timer_runner(s_motion_planning_time_id);
+        MemoizationKey key      = createMemoizationKey(species, initial_configuration, goal_configuration);
+        MemoizationShard& shard = memoizationShard(key);
+
+        // Either find a previous (or in-flight) computation or claim the query for this thread
+        std::promise<std::shared_ptr<const MotionPlannerQueryResultBase>> promise;
         {
-            return result;
+            std::unique_lock lock(shard.mutex);
+            if(auto iter = shard.memoization.find(key); iter != shard.memoization.end())
+            {
+                MemoizationValue future = iter->second;
+                lock.unlock();
+                return future.get();
+            }
+            shard.memoization.emplace(key, promise.get_future().share());
+            ++m_num_motion_plans;
         }
 
-        // Compute and memoize
-        std::shared_ptr<const MotionPlannerQueryResultBase> result =
-            computeMotionPlan(species, initial_configuration, goal_configuration);
-        auto iter = m_memoization.emplace(std::weak_ptr<const Species>(species),
-                                          std::make_tuple(initial_configuration, goal_configuration, result));
+        // Compute outside of the lock
+        std::shared_ptr<const MotionPlannerQueryResultBase> result;
+        try
+        {
+            result = computeMotionPlan(species, initial_configuration, goal_configuration);
+        }
+        catch(...)
+        {
+            // Don't memoize failures so that a later query can retry, but still wake any waiting threads
+            {
+                std::lock_guard lock(shard.mutex);
+                if(shard.memoization.erase(key) > 0)
+                {
+                    --m_num_motion_plans;
+                }
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+        // A query cut short by the deadline may have failed only because of it, so a later search should retry it
+        if(m_deadline && m_deadline->expired())
+        {
+            std::lock_guard lock(shard.mutex);
+            if(shard.memoization.erase(key) > 0)
+            {
+                --m_num_motion_plans;
+            }
+        }
+        promise.set_value(result);
         return result;
     }
 
@@ -200,8 +254,7 @@ namespace grstapse
                                        const std::shared_ptr<const ConfigurationBase>& initial_configuration,
                                        const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
     {
-        std::lock_guard lock(m_mutex);
-        TimerRunner timer_runner(constants::k_motion_planning_time);
+        TimerRunner timer_runner(s_motion_planning_time_id);
         return getMemoized(species, initial_configuration, goal_configuration) != nullptr;
     }
 
@@ -210,36 +263,63 @@ namespace grstapse
         const std::shared_ptr<const ConfigurationBase>& initial_configuration,
         const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
     {
-        if(!m_memoization.contains(species))
-        {
-            return nullptr;
-        }
+        const MemoizationKey key = createMemoizationKey(species, initial_configuration, goal_configuration);
+        MemoizationShard& shard  = memoizationShard(key);
 
-        auto range = m_memoization.equal_range(species);
-        for(auto iter = range.first; iter != range.second; ++iter)
+        MemoizationValue future;
         {
-            const MemoizationValue& mv = iter->second;
-            if(*std::get<0>(mv) != *initial_configuration)
-            {
-                continue;
-            }
-            if(*std::get<1>(mv) != *goal_configuration)
+            std::lock_guard lock(shard.mutex);
+            auto iter = shard.memoization.find(key);
+            if(iter == shard.memoization.end())
             {
-                continue;
+                return nullptr;
             }
-            return std::get<2>(mv);
+            future = iter->second;
         }
 
-        return nullptr;
+        // A query that is still being computed is not memoized yet
+        if(future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return nullptr;
+        }
+        return future.get();
     }
 
     void MotionPlannerBase::clearCache()
     {
-        m_memoization.clear();
+        for(MemoizationShard& shard: m_memoization_shards)
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.memoization.clear();
+        }
+        m_num_motion_plans = 0;
+    }
+
+    MotionPlannerBase::MemoizationKey MotionPlannerBase::createMemoizationKey(
+        const std::shared_ptr<const Species>& species,
+        const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+        const std::shared_ptr<const ConfigurationBase>& goal_configuration)
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, species.get());
+        boost::hash_combine(seed, initial_configuration->hash());
+        boost::hash_combine(seed, goal_configuration->hash());
+        return MemoizationKey{.species               = species,
+                              .initial_configuration = initial_configuration,
+                              .goal_configuration    = goal_configuration,
+                              .hash                  = seed};
+    }
+
+    bool MotionPlannerBase::MemoizationKeyEqual::operator()(const MemoizationKey& lhs, const MemoizationKey& rhs) const
+    {
+        // Species are compared by identity (as the ownership of the weak pointers)
+        return lhs.hash == rhs.hash && !lhs.species.owner_before(rhs.species) &&
+               !rhs.species.owner_before(lhs.species) && *lhs.initial_configuration == *rhs.initial_configuration &&
+               *lhs.goal_configuration == *rhs.goal_configuration;
     }
 
     unsigned int MotionPlannerBase::numFailures()
     {
-        return s_num_failures;
+        return static_cast<unsigned int>(Metrics::current().value(s_num_failures_id));
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -35,6 +35,7 @@
 #include <ompl/geometric/planners/rrt/pRRT.h>
 // Local
 #include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/deadline.hpp"
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/json_extension.hpp"
 #include "grstapse/common/utilities/logger.hpp"
@@ -125,6 +126,8 @@ namespace grstapse
         const std::shared_ptr<const ConfigurationBase>& initial_configuration,
         const std::shared_ptr<const ConfigurationBase>& goal_configuration)
     {
+        // The simple setup holds the state of a single query
+        std::lock_guard<std::mutex> lock(m_mutex);
         if(!m_simple_setup)
         {
             throw createLogicError("Motion planning not initialized");
@@ -151,12 +154,24 @@ namespace grstapse
         // Set the radius of the robot
         m_environment->lock();
         m_environment->setSpecies(species);
-        const ompl::base::PlannerStatus status = m_simple_setup->solve(ompl::base::plannerOrTerminationCondition(
+        ompl::base::PlannerTerminationCondition termination_condition = ompl::base::plannerOrTerminationCondition(
             ompl::base::timedPlannerTerminationCondition(m_parameters->get<float>(constants::k_timeout)),
             ompl::base::CostConvergenceTerminationCondition(
                 m_simple_setup->getProblemDefinition(),
                 m_parameters->get<unsigned int>(constants::k_solutions_window),
-                m_parameters->get<float>(constants::k_convergence_epsilon))));
+                m_parameters->get<float>(constants::k_convergence_epsilon)));
+        if(m_deadline)
+        {
+            // Stop planning once the search this query belongs to runs out of time
+            termination_condition = ompl::base::plannerOrTerminationCondition(
+                termination_condition,
+                ompl::base::PlannerTerminationCondition(
+                    [deadline = m_deadline]() -> bool
+                    {
+                        return deadline->expired();
+                    }));
+        }
+        const ompl::base::PlannerStatus status = m_simple_setup->solve(termination_condition);
 
         switch(status.operator ompl::base::PlannerStatus::StatusType())
         {
@@ -177,7 +192,7 @@ namespace grstapse
                 // Clear the species from the environment
                 m_environment->setSpecies(nullptr);
                 m_environment->unlock();
-                ++s_num_failures;
+                Metrics::current().increment(s_num_failures_id);
                 Logger::warn("Motion planner timed out");
                 return std::make_shared<const OmplMotionPlannerQueryResult>(MotionPlannerQueryStatus::e_timeout,
                                                                             nullptr);
@@ -187,7 +202,7 @@ namespace grstapse
                 // Clear the species from the environment
                 m_environment->setSpecies(nullptr);
                 m_environment->unlock();
-                ++s_num_failures;
+                Metrics::current().increment(s_num_failures_id);
                 Logger::warn("Motion planning returned an approximate solution. This is considered a failure as they "
                              "contain jumps.");
                 return std::make_shared<const OmplMotionPlannerQueryResult>(MotionPlannerQueryStatus::e_failure,
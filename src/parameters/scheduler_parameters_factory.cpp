@@ -44,6 +44,8 @@ namespace grstapse
                   constants::k_stochastic_milp_scheduler_parameters);
         setParent(constants::k_gnn_heuristic_approximation_stochastic_scheduler_parameters,
                   constants::k_heuristic_approximation_stochastic_scheduler_parameters);
+        setParent(constants::k_native_gnn_heuristic_approximation_stochastic_scheduler_parameters,
+                  constants::k_heuristic_approximation_stochastic_scheduler_parameters);
 
         // Set required parameters
         setRequired(constants::k_scheduler_parameters, {{constants::k_timeout, nlohmann::json::value_t::number_float}});
@@ -54,14 +56,14 @@ namespace grstapse
                     {{constants::k_gamma, nlohmann::json::value_t::number_float},
                      {constants::k_num_scenarios, nlohmann::json::value_t::number_unsigned},
                      {constants::k_use_sprt, nlohmann::json::value_t::boolean},
-                     {constants::k_delta_percentage, nlohmann::json::value_t::boolean},
-                     {constants::k_delta, nlohmann::json::value_t::number_float},
                      {constants::k_indifference_tolerance, nlohmann::json::value_t::number_float}});
         setRequired(constants::k_heuristic_approximation_stochastic_scheduler_parameters,
                     {{constants::k_beta, nlohmann::json::value_t::number_unsigned}});
         setRequired(constants::k_gnn_heuristic_approximation_stochastic_scheduler_parameters,
                     {{constants::k_model_filepath, nlohmann::json::value_t::string},
                      {constants::k_model_parameters_filepath, nlohmann::json::value_t::string}});
+        setRequired(constants::k_native_gnn_heuristic_approximation_stochastic_scheduler_parameters,
+                    {{constants::k_gnn_weights_filepath, nlohmann::json::value_t::string}});
 
         // Set optional parameters
         setOptional(constants::k_scheduler_parameters, {});
@@ -70,12 +72,20 @@ namespace grstapse
                      {constants::k_mip_gap, nlohmann::json::value_t::number_float},
                      {constants::k_heuristic_time, nlohmann::json::value_t::number_float},
                      {constants::k_method, nlohmann::json::value_t::number_integer},
-                     {constants::k_return_feasible_on_timeout, nlohmann::json::value_t::boolean}});
+                     {constants::k_return_feasible_on_timeout, nlohmann::json::value_t::boolean},
+                     {constants::k_warm_start, nlohmann::json::value_t::boolean}});
         setOptional(constants::k_deterministic_milp_scheduler_parameters,
                     {{constants::k_use_hierarchical_objective, nlohmann::json::value_t::boolean}});
-        setOptional(constants::k_stochastic_milp_scheduler_parameters, {});
-        setOptional(constants::k_heuristic_approximation_stochastic_scheduler_parameters, {});
+        // Deprecated: delta and delta_percentage are from the old linear robust makespan search. They are still
+        // accepted so that existing configurations validate, but they are ignored (the SPRT finds the robust makespan)
+        setOptional(constants::k_stochastic_milp_scheduler_parameters,
+                    {{constants::k_delta_percentage, nlohmann::json::value_t::boolean},
+                     {constants::k_delta, nlohmann::json::value_t::number_float},
+                     {constants::k_num_reduced_scenarios, nlohmann::json::value_t::number_unsigned}});
+        setOptional(constants::k_heuristic_approximation_stochastic_scheduler_parameters,
+                    {{constants::k_seed, nlohmann::json::value_t::number_unsigned}});
         setOptional(constants::k_gnn_heuristic_approximation_stochastic_scheduler_parameters, {});
+        setOptional(constants::k_native_gnn_heuristic_approximation_stochastic_scheduler_parameters, {});
 
         // Set default values for optional parameters
         setDefault(constants::k_scheduler_parameters, {});
@@ -84,11 +94,15 @@ namespace grstapse
                     {constants::k_mip_gap, -1.0f},
                     {constants::k_heuristic_time, -1.0f},
                     {constants::k_method, -1},
-                    {constants::k_return_feasible_on_timeout, false}});
+                    {constants::k_return_feasible_on_timeout, false},
+                    {constants::k_warm_start, false}});
         setDefault(constants::k_deterministic_milp_scheduler_parameters,
                    {{constants::k_use_hierarchical_objective, false}});
-        setDefault(constants::k_stochastic_milp_scheduler_parameters, {});
+        // 0 schedules over every F set scenario instead of a reduced set
+        setDefault(constants::k_stochastic_milp_scheduler_parameters, {{constants::k_num_reduced_scenarios, 0}});
+        // Without a seed, one is drawn from std::random_device
         setDefault(constants::k_heuristic_approximation_stochastic_scheduler_parameters, {});
         setDefault(constants::k_gnn_heuristic_approximation_stochastic_scheduler_parameters, {});
+        setDefault(constants::k_native_gnn_heuristic_approximation_stochastic_scheduler_parameters, {});
     }
 }  // namespace grstapse
\ No newline at end of file
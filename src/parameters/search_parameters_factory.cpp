@@ -57,7 +57,10 @@ namespace grstapse
         setOptional(constants::k_search_parameters, {});
         setOptional(constants::k_best_first_search_parameters,
                     {{constants::k_save_pruned_nodes, nlohmann::json::value_t::boolean},
-                     {constants::k_save_closed_nodes, nlohmann::json::value_t::boolean}});
+                     {constants::k_save_closed_nodes, nlohmann::json::value_t::boolean},
+                     {constants::k_threads, nlohmann::json::value_t::number_unsigned},
+                     {constants::k_lazy_evaluation, nlohmann::json::value_t::boolean},
+                     {constants::k_low_memory, nlohmann::json::value_t::boolean}});
         setOptional(constants::k_focal_a_star_parameters, {});
         setOptional(constants::k_conflict_based_search_parameters,
                     {{constants::k_constraint_tree_node_cost_type, nlohmann::json::value_t::string}});
@@ -65,7 +68,11 @@ namespace grstapse
         // Set default values for optional parameters
         setDefault(constants::k_search_parameters, {});
         setDefault(constants::k_best_first_search_parameters,
-                   {{constants::k_save_pruned_nodes, false}, {constants::k_save_closed_nodes, false}});
+                   {{constants::k_save_pruned_nodes, false},
+                    {constants::k_save_closed_nodes, false},
+                    {constants::k_threads, 1},
+                    {constants::k_lazy_evaluation, false},
+                    {constants::k_low_memory, false}});
         setDefault(constants::k_focal_a_star_parameters, {});
         setDefault(constants::k_conflict_based_search_parameters,
                    {{constants::k_constraint_tree_node_cost_type, ConstraintTreeNodeCostType::e_makespan}});
@@ -24,6 +24,7 @@
 
 // Global
 #include <fstream>
+#include <functional>
 // External
 #include <fmt/format.h>
 // Local
@@ -51,7 +52,8 @@
 namespace grstapse
 {
     GrstapsProblemInputs::GrstapsProblemInputs(const ThisIsProtectedTag&)
-        : m_task_configuration_type(ConfigurationType::e_unknown)
+        : m_motion_planners_hash(0)
+        , m_task_configuration_type(ConfigurationType::e_unknown)
         , m_ompl_state_space_type(OmplStateSpaceType::e_unknown)
         , m_graph_type(GraphType::e_unknown)
     {}
@@ -146,6 +148,8 @@ namespace grstapse
         }
 
         MotionPlannerBase::init();
+        // Identifies the environments (including the files they are loaded from) for anything persisted across runs
+        m_motion_planners_hash = std::hash<std::string>{}(j.dump());
         m_motion_planners.reserve(j.size());
         for(const nlohmann::json& individual_mp: j)
         {
@@ -82,9 +82,9 @@ namespace grstapse
             Logger::warn("GrstapsProblemInput is NULL");
         }
 
-        m_precedence_constraints = addPrecedenceTransitiveConstraints(precedence_constraints);
-        m_use_reverse            = false;
-        m_max_schedule           = 0;
+        setPrecedenceConstraints(precedence_constraints);
+        m_use_reverse  = false;
+        m_max_schedule = 0;
 
         computeScheduleBestWorst();
     }
@@ -111,7 +111,7 @@ namespace grstapse
         {
             Logger::warn("GrstapsProblemInput is NULL");
         }
-        m_precedence_constraints = addPrecedenceTransitiveConstraints(precedence_constraints);
+        setPrecedenceConstraints(precedence_constraints);
         computeScheduleBestWorst();
     }
 
@@ -136,10 +136,17 @@ namespace grstapse
         {
             Logger::warn("GrstapsProblemInput is NULL");
         }
-        m_precedence_constraints = addPrecedenceTransitiveConstraints(precedence_constraints);
+        setPrecedenceConstraints(precedence_constraints);
         computeScheduleBestWorst();
     }
 
+    void ItagsProblemInputs::setPrecedenceConstraints(
+        const std::set<std::pair<unsigned int, unsigned int>>& precedence_constraints)
+    {
+        m_precedence_closure     = PrecedenceClosure(precedence_constraints, numberOfPlanTasks());
+        m_precedence_constraints = m_precedence_closure.constraints();
+    }
+
     void ItagsProblemInputs::validate() const
     {
         unsigned int num_plan_task = numberOfPlanTasks();
@@ -356,7 +363,7 @@ namespace nlohmann
 
         std::set<std::pair<unsigned int, unsigned int>> tmp;
         j.at(grstapse::constants::k_precedence_constraints).get_to(tmp);
-        problem_inputs->m_precedence_constraints = grstapse::addPrecedenceTransitiveConstraints(std::move(tmp));
+        problem_inputs->setPrecedenceConstraints(tmp);
         problem_inputs->m_desired_traits_matrix =
             desiredTraitsMatrix(problem_inputs->m_grstaps_problem_inputs->m_tasks, problem_inputs->m_plan_task_indices);
         problem_inputs->m_linear_coefficient_matrix =
@@ -39,21 +39,29 @@ namespace grstapse
     SchedulerProblemInputs::SchedulerProblemInputs(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
                                                    const Eigen::MatrixXf& allocation)
         : m_itags_problem_inputs(problem_inputs)
-        , m_mutex_constraints(computeMutexConstraints(allocation))
+        , m_mutex_set(allocation)
         , m_allocation(allocation)
     {}
 
     SchedulerProblemInputs::SchedulerProblemInputs(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
                                                    Eigen::MatrixXf&& allocation)
         : m_itags_problem_inputs(problem_inputs)
-        , m_mutex_constraints(computeMutexConstraints(allocation))
+        , m_mutex_set(allocation)
         , m_allocation(std::move(allocation))
     {}
 
+    SchedulerProblemInputs::SchedulerProblemInputs(const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
+                                                   const Eigen::MatrixXf& allocation,
+                                                   const MutexSet& mutex_set)
+        : m_itags_problem_inputs(problem_inputs)
+        , m_mutex_set(mutex_set)
+        , m_allocation(allocation)
+    {}
+
     void SchedulerProblemInputs::validate() const
     {
         unsigned int num_plan_task = numberOfPlanTasks();
-        for(const std::pair<unsigned int, unsigned int>& constraint: m_mutex_constraints)
+        for(const std::pair<unsigned int, unsigned int>& constraint: m_mutex_set.constraints())
         {
             if(constraint.first >= num_plan_task || constraint.second >= num_plan_task)
             {
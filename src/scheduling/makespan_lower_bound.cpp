@@ -0,0 +1,148 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/makespan_lower_bound.hpp"
+
+// Global
+#include <limits>
+#include <vector>
+// Local
+#include "grstapse/problem_inputs/itags_problem_inputs.hpp"
+#include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
+#include "grstapse/robot.hpp"
+#include "grstapse/scheduling/milp/deterministic/longest_path_evaluator.hpp"
+#include "grstapse/scheduling/scheduler_motion_planner_interface_base.hpp"
+#include "grstapse/task.hpp"
+
+namespace grstapse
+{
+    float computeMakespanLowerBound(const ItagsProblemInputs& problem_inputs,
+                                    const Eigen::MatrixXf& allocation,
+                                    const SchedulerMotionPlannerInterfaceBase& motion_planner_interface)
+    {
+        const unsigned int num_tasks  = problem_inputs.numberOfPlanTasks();
+        const unsigned int num_robots = problem_inputs.numberOfRobots();
+
+        std::vector<std::vector<std::shared_ptr<const Robot>>> coalitions(num_tasks);
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+            {
+                if(allocation(task_nr, robot_nr) > 0.5f)
+                {
+                    coalitions[task_nr].push_back(problem_inputs.robot(robot_nr));
+                }
+            }
+        }
+
+        // Precedence constraints
+        LongestPathEvaluator evaluator(num_tasks);
+        std::vector<float> durations(num_tasks);
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            const std::shared_ptr<const Task>& task = problem_inputs.planTask(task_nr);
+            durations[task_nr] = motion_planner_interface.computeTaskDurationHeuristic(task, coalitions[task_nr]);
+
+            float lower_bound = 0.0f;
+            for(const std::shared_ptr<const Robot>& robot: coalitions[task_nr])
+            {
+                lower_bound = std::max(lower_bound,
+                                       motion_planner_interface.computeInitialTransitionDurationHeuristic(
+                                           task->initialConfiguration(),
+                                           robot));
+            }
+            evaluator.setTask(task_nr, lower_bound, durations[task_nr]);
+        }
+        for(auto [predecessor, successor]: problem_inputs.precedenceConstraints())
+        {
+            float transition_duration = 0.0f;
+            for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+            {
+                if(allocation(predecessor, robot_nr) > 0.5f && allocation(successor, robot_nr) > 0.5f)
+                {
+                    transition_duration =
+                        std::max(transition_duration,
+                                 motion_planner_interface.computeTransitionDurationHeuristic(
+                                     problem_inputs.planTask(predecessor)->terminalConfiguration(),
+                                     problem_inputs.planTask(successor)->initialConfiguration(),
+                                     problem_inputs.robot(robot_nr)));
+                }
+            }
+            evaluator.addEdge(predecessor, successor, transition_duration);
+        }
+        float bound = evaluator.evaluate().makespan;
+
+        // Mutex constraints: each robot performs its tasks one at a time in some order
+        for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+        {
+            const std::shared_ptr<const Robot>& robot = problem_inputs.robot(robot_nr);
+            std::vector<unsigned int> tasks;
+            float total_duration = 0.0f;
+            float first_start    = std::numeric_limits<float>::infinity();
+            for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+            {
+                if(allocation(task_nr, robot_nr) > 0.5f)
+                {
+                    tasks.push_back(task_nr);
+                    total_duration += durations[task_nr];
+                    first_start = std::min(first_start,
+                                           motion_planner_interface.computeInitialTransitionDurationHeuristic(
+                                               problem_inputs.planTask(task_nr)->initialConfiguration(),
+                                               robot));
+                }
+            }
+            if(tasks.empty())
+            {
+                continue;
+            }
+
+            // Every transition between consecutive tasks takes at least as long as the shortest one
+            float shortest_transition = tasks.size() > 1 ? std::numeric_limits<float>::infinity() : 0.0f;
+            for(unsigned int i: tasks)
+            {
+                for(unsigned int j: tasks)
+                {
+                    if(i != j)
+                    {
+                        shortest_transition = std::min(shortest_transition,
+                                                       motion_planner_interface.computeTransitionDurationHeuristic(
+                                                           problem_inputs.planTask(i)->terminalConfiguration(),
+                                                           problem_inputs.planTask(j)->initialConfiguration(),
+                                                           robot));
+                    }
+                }
+            }
+            bound = std::max(bound,
+                             first_start + total_duration +
+                                 static_cast<float>(tasks.size() - 1) * shortest_transition);
+        }
+        return bound;
+    }
+
+    float computeMakespanLowerBound(const SchedulerProblemInputs& problem_inputs,
+                                    const SchedulerMotionPlannerInterfaceBase& motion_planner_interface)
+    {
+        return computeMakespanLowerBound(*problem_inputs.itagsProblemInputs(),
+                                         problem_inputs.allocation(),
+                                         motion_planner_interface);
+    }
+}  // namespace grstapse
\ No newline at end of file
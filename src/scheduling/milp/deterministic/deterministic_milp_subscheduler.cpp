@@ -130,6 +130,30 @@ namespace grstapse
         return ranges::max(distance);
     }
 
+    LongestPathResult DeterministicMilpSubscheduler::longestPath(
+        const std::vector<std::pair<unsigned int, unsigned int>>& mutex_orderings) const
+    {
+        const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+        LongestPathEvaluator evaluator(num_tasks);
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            evaluator.setTask(i, m_task_info.taskLowerBound(i), m_task_info.taskDuration(i));
+        }
+        for(auto [predecessor, successor]: m_problem_inputs->precedenceConstraints())
+        {
+            evaluator.addEdge(predecessor,
+                              successor,
+                              m_transition_info.transitionDurationLowerBound(predecessor, successor));
+        }
+        for(auto [predecessor, successor]: mutex_orderings)
+        {
+            evaluator.addEdge(predecessor,
+                              successor,
+                              m_transition_info.transitionDurationLowerBound(predecessor, successor));
+        }
+        return evaluator.evaluate();
+    }
+
     double DeterministicMilpSubscheduler::dualCutAlphaComponent(GRBModel& model) const
     {
         double rv = 0.0;
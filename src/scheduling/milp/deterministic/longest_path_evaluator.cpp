@@ -0,0 +1,123 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/milp/deterministic/longest_path_evaluator.hpp"
+
+// Global
+#include <algorithm>
+#include <limits>
+
+namespace grstapse
+{
+    LongestPathEvaluator::LongestPathEvaluator(unsigned int num_tasks)
+        : m_lower_bounds(num_tasks, 0.0f)
+        , m_durations(num_tasks, 0.0f)
+        , m_successors(num_tasks)
+    {}
+
+    void LongestPathEvaluator::setTask(unsigned int task_nr, float lower_bound, float duration)
+    {
+        m_lower_bounds[task_nr] = lower_bound;
+        m_durations[task_nr]    = duration;
+    }
+
+    void LongestPathEvaluator::addEdge(unsigned int predecessor, unsigned int successor, float transition_duration)
+    {
+        m_successors[predecessor].emplace_back(successor, transition_duration);
+    }
+
+    LongestPathResult LongestPathEvaluator::evaluate() const
+    {
+        constexpr unsigned int k_none = std::numeric_limits<unsigned int>::max();
+        const unsigned int num_tasks  = m_durations.size();
+        if(num_tasks == 0)
+        {
+            return LongestPathResult{.makespan = 0.0f, .critical_chain = {}};
+        }
+
+        std::vector<unsigned int> in_degree(num_tasks, 0);
+        for(const auto& successors: m_successors)
+        {
+            for(const auto& [successor, transition_duration]: successors)
+            {
+                ++in_degree[successor];
+            }
+        }
+
+        // Kahn's algorithm, relaxing the start times as each task is removed
+        std::vector<float> start = m_lower_bounds;
+        std::vector<unsigned int> predecessor(num_tasks, k_none);
+        std::vector<unsigned int> open;
+        open.reserve(num_tasks);
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            if(in_degree[i] == 0)
+            {
+                open.push_back(i);
+            }
+        }
+
+        unsigned int num_visited = 0;
+        while(!open.empty())
+        {
+            const unsigned int i = open.back();
+            open.pop_back();
+            ++num_visited;
+
+            const float finish = start[i] + m_durations[i];
+            for(const auto& [j, transition_duration]: m_successors[i])
+            {
+                if(finish + transition_duration > start[j])
+                {
+                    start[j]       = finish + transition_duration;
+                    predecessor[j] = i;
+                }
+                if(--in_degree[j] == 0)
+                {
+                    open.push_back(j);
+                }
+            }
+        }
+
+        if(num_visited < num_tasks)
+        {
+            return LongestPathResult{.makespan = std::numeric_limits<float>::infinity(), .critical_chain = {}};
+        }
+
+        unsigned int last = 0;
+        for(unsigned int i = 1; i < num_tasks; ++i)
+        {
+            if(start[i] + m_durations[i] > start[last] + m_durations[last])
+            {
+                last = i;
+            }
+        }
+
+        LongestPathResult rv{.makespan = start[last] + m_durations[last], .critical_chain = {}};
+        for(unsigned int i = last; i != k_none; i = predecessor[i])
+        {
+            rv.critical_chain.push_back(i);
+        }
+        std::reverse(rv.critical_chain.begin(), rv.critical_chain.end());
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -25,14 +25,17 @@
 // Local
 #include "grstapse/common/milp/milp_failure_reason.hpp"
 #include "grstapse/common/milp/milp_solver_result.hpp"
+#include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/geometric_planning/configurations/configuration_base.hpp"
+#include "grstapse/parameters/parameters_base.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/scheduling/milp/mutex_indicators.hpp"
+#include "grstapse/scheduling/schedule_base.hpp"
 #include "grstapse/scheduling/scheduler_result.hpp"
 
 namespace grstapse
 {
-    unsigned int MilpSchedulerBase::s_num_iterations = 0;
+    const MetricId MilpSchedulerBase::s_num_iterations_id = Metrics::intern(constants::k_num_scheduling_iterations);
 
     MilpSchedulerBase::MilpSchedulerBase(const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
                                          const std::shared_ptr<MutexIndicators>& mutex_indicators,
@@ -44,7 +47,13 @@ namespace grstapse
 
     unsigned int MilpSchedulerBase::numIterations()
     {
-        return s_num_iterations;
+        return static_cast<unsigned int>(Metrics::current().value(s_num_iterations_id));
+    }
+
+    void MilpSchedulerBase::setDeadline(const std::shared_ptr<const Deadline>& deadline)
+    {
+        SchedulerBase::setDeadline(deadline);
+        MilpSolverBase::setDeadline(deadline);
     }
 
     std::shared_ptr<const grstapse::SchedulerResult> MilpSchedulerBase::computeSchedule()
@@ -55,7 +64,7 @@ namespace grstapse
             return std::make_shared<SchedulerResult>(result->failureReason());
         }
 
-        s_num_iterations += result->numIterations();
+        Metrics::current().increment(s_num_iterations_id, result->numIterations());
 
         if(auto schedule = createSchedule(*result->model()); schedule)
         {
@@ -106,6 +115,29 @@ namespace grstapse
         return nullptr;
     }
 
+    void MilpSchedulerBase::setStartValues(GRBModel& model)
+    {
+        const std::shared_ptr<const ParametersBase>& parameters = m_problem_inputs->schedulerParameters();
+        if(m_warm_start == nullptr || !parameters->contains(constants::k_warm_start) ||
+           !parameters->get<bool>(constants::k_warm_start))
+        {
+            return;
+        }
+
+        // Only the binary variables are set; the solver derives the continuous timepoints from them
+        for(auto [predecessor, successor]: m_warm_start->precedenceSetMutexConstraints())
+        {
+            if(m_mutex_indicators->contains({predecessor, successor}))
+            {
+                m_mutex_indicators->get({predecessor, successor}).set(GRB_DoubleAttr_Start, 1.0);
+            }
+            else if(m_mutex_indicators->contains({successor, predecessor}))
+            {
+                m_mutex_indicators->get({successor, predecessor}).set(GRB_DoubleAttr_Start, 0.0);
+            }
+        }
+    }
+
     double MilpSchedulerBase::getM() const
     {
         return m_problem_inputs->scheduleWorstMakespan();
@@ -29,20 +29,20 @@
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/scheduling/milp/ms_name_scheme_base.hpp"
+#include "grstapse/scheduling/precedence_closure.hpp"
 
 namespace grstapse
 {
     MutexIndicators::MutexIndicators(const std::set<std::pair<unsigned int, unsigned int>>& mutex_constraints,
-                                     const std::set<std::pair<unsigned int, unsigned int>>& precedence_constraints,
+                                     const PrecedenceClosure& precedence_closure,
                                      const std::shared_ptr<const MsNameSchemeBase>& name_scheme,
                                      bool master)
-        : m_precedence_constraints(precedence_constraints)
-        , m_name_scheme(name_scheme)
+        : m_name_scheme(name_scheme)
         , m_master(master)
     {
         for(const auto& p: mutex_constraints)
         {
-            if(m_precedence_constraints.contains(p) || m_precedence_constraints.contains({p.second, p.first}))
+            if(precedence_closure.ordered(p.first, p.second))
             {
                 continue;
             }
@@ -52,11 +52,25 @@ namespace grstapse
         }
     }
 
+    MutexIndicators::MutexIndicators(
+        const std::vector<std::pair<unsigned int, unsigned int>>& unordered_mutex_constraints,
+        const std::shared_ptr<const MsNameSchemeBase>& name_scheme,
+        bool master)
+        : m_name_scheme(name_scheme)
+        , m_master(master)
+    {
+        m_indicators.reserve(unordered_mutex_constraints.size());
+        for(const auto& p: unordered_mutex_constraints)
+        {
+            // Give an empty GRBVar for now
+            m_indicators[p] = GRBVar();
+        }
+    }
+
     MutexIndicators::MutexIndicators(const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
                                      const std::shared_ptr<const MsNameSchemeBase>& name_scheme,
                                      bool master)
-        : MutexIndicators(problem_inputs->mutexConstraints(),
-                          problem_inputs->precedenceConstraints(),
+        : MutexIndicators(problem_inputs->mutexSet().unorderedConstraints(problem_inputs->precedenceClosure()),
                           name_scheme,
                           master)
     {}
@@ -0,0 +1,118 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/milp/stochastic/benders/benders_cut_pool.hpp"
+
+// Local
+#include "grstapse/scheduling/mutex_set.hpp"
+#include "grstapse/scheduling/precedence_closure.hpp"
+
+namespace grstapse
+{
+    BendersCutPool::BendersCutPool(unsigned int max_chains_per_scenario)
+        : m_max_chains_per_scenario(max_chains_per_scenario)
+    {}
+
+    void BendersCutPool::add(unsigned int scenario, const std::vector<unsigned int>& chain)
+    {
+        if(chain.empty() || m_max_chains_per_scenario == 0)
+        {
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        if(scenario >= m_scenarios.size())
+        {
+            m_scenarios.resize(scenario + 1);
+        }
+        ScenarioChains& scenario_chains = m_scenarios[scenario];
+        if(!scenario_chains.contained.insert(chain).second)
+        {
+            return;
+        }
+        scenario_chains.chains.push_back(chain);
+        if(scenario_chains.chains.size() > m_max_chains_per_scenario)
+        {
+            scenario_chains.contained.erase(scenario_chains.chains.front());
+            scenario_chains.chains.pop_front();
+        }
+    }
+
+    std::vector<std::vector<unsigned int>> BendersCutPool::validChains(unsigned int scenario,
+                                                                       const PrecedenceClosure& precedence_closure,
+                                                                       const MutexSet& mutex_set) const
+    {
+        std::vector<std::vector<unsigned int>> rv;
+        std::lock_guard lock(m_mutex);
+        if(scenario >= m_scenarios.size())
+        {
+            return rv;
+        }
+        for(const std::vector<unsigned int>& chain: m_scenarios[scenario].chains)
+        {
+            if(isValid(chain, precedence_closure, mutex_set))
+            {
+                rv.push_back(chain);
+            }
+        }
+        return rv;
+    }
+
+    bool BendersCutPool::isValid(const std::vector<unsigned int>& chain,
+                                 const PrecedenceClosure& precedence_closure,
+                                 const MutexSet& mutex_set)
+    {
+        const unsigned int num_tasks = mutex_set.numberOfTasks();
+        for(unsigned int k = 0; k < chain.size(); ++k)
+        {
+            if(chain[k] >= num_tasks)
+            {
+                return false;
+            }
+        }
+        for(unsigned int k = 1; k < chain.size(); ++k)
+        {
+            const unsigned int predecessor = chain[k - 1];
+            const unsigned int successor   = chain[k];
+            if(precedence_closure.precedes(predecessor, successor))
+            {
+                continue;
+            }
+            if(!mutex_set.contains(predecessor, successor) || precedence_closure.precedes(successor, predecessor))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    unsigned int BendersCutPool::size() const
+    {
+        std::lock_guard lock(m_mutex);
+        unsigned int rv = 0;
+        for(const ScenarioChains& scenario_chains: m_scenarios)
+        {
+            rv += scenario_chains.chains.size();
+        }
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -22,6 +22,8 @@
  */
 #include "grstapse/scheduling/milp/stochastic/benders/benders_parallel_stochastic_milp_scheduler.hpp"
 
+// Global
+#include <limits>
 // External
 #include <omp.h>
 // Local
@@ -30,15 +32,18 @@
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/scheduling/milp/mutex_indicators.hpp"
+#include "grstapse/scheduling/milp/stochastic/benders/benders_cut_pool.hpp"
 
 namespace grstapse
 {
     BendersParallelStochasticMilpScheduler::BendersParallelStochasticMilpScheduler(
         const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
-        const std::shared_ptr<const SmsNameSchemeBase>& name_scheme)
-        : BendersStochasticMilpSchedulerBase(problem_inputs, name_scheme)
+        const std::shared_ptr<const SmsNameSchemeBase>& name_scheme,
+        const std::shared_ptr<BendersCutPool>& cut_pool)
+        : BendersStochasticMilpSchedulerBase(problem_inputs, name_scheme, cut_pool)
         , m_y_indicator_values(m_num_scenarios)
         , m_subproblem_makespans(m_num_scenarios)
+        , m_critical_paths(m_num_scenarios)
     {}
 
     void BendersParallelStochasticMilpScheduler::makeCuts(MilpSolverBase::BendersCallback& callback)
@@ -54,32 +59,21 @@ namespace grstapse
             m_y_indicator_values[q] = var_x > 0.5;
         }
 
-#pragma omp parallel for shared(m_subschedulers,                                                                       \
-                                m_mutex_indicator_values,                                                              \
-                                m_y_indicator_values,                                                                  \
-                                m_subproblem_mutex_indicators,                                                         \
-                                m_subproblem_makespans)
-        for(unsigned int q = 0; q < m_num_scenarios; ++q)
+        std::vector<std::pair<unsigned int, unsigned int>> mutex_orderings;
+        mutex_orderings.reserve(m_mutex_indicator_values.size());
+        for(auto [p, v]: m_mutex_indicator_values)
         {
-            //            if(m_y_indicator_values[q])
-            //            {
-            //                m_subproblem_makespans[q] = std::numeric_limits<float>::infinity();
-            //                continue;
-            //            }
-
-            for(auto& [p, var]: m_subproblem_mutex_indicators[q]->indicators())
-            {
-                fixVariable(var, m_mutex_indicator_values.at(p) ? 1.0 : 0.0);
-            }
-
-            std::shared_ptr<MilpSolverResult> result = m_subschedulers[q]->resolve(true);
-            if(result->failure())
-            {
-                m_subproblem_makespans[q] = -1.0f;
-                continue;
-            }
+            mutex_orderings.push_back(v ? p : std::pair(p.second, p.first));
+        }
 
-            m_subproblem_makespans[q] = variableValue(m_subschedulers[q]->makespanVariable());
+        // With the mutex indicators fixed, each subproblem is a longest path problem
+#pragma omp parallel for shared(m_subschedulers, mutex_orderings, m_critical_paths, m_subproblem_makespans)
+        for(unsigned int q = 0; q < m_num_scenarios; ++q)
+        {
+            m_critical_paths[q]       = m_subschedulers[q]->longestPath(mutex_orderings);
+            m_subproblem_makespans[q] = m_critical_paths[q].makespan == std::numeric_limits<float>::infinity()
+                                            ? -1.0f
+                                            : m_critical_paths[q].makespan;
         }
 
         if(std::any_of(m_subproblem_makespans.begin(),
@@ -92,6 +86,14 @@ namespace grstapse
             throw createLogicError("sub-problem failed");
         }
 
+        if(m_cut_pool != nullptr)
+        {
+            for(unsigned int q = 0; q < m_num_scenarios; ++q)
+            {
+                m_cut_pool->add(q, m_critical_paths[q].critical_chain);
+            }
+        }
+
 #ifdef DEBUG
         std::unordered_map<std::pair<unsigned int, unsigned int>, double> mutex_indicators_stubs;
         for(auto [p, v]: m_mutex_indicator_values)
@@ -110,7 +112,8 @@ namespace grstapse
 //            }
 #ifdef DEBUG
 
-            const double dual_objective = m_subschedulers[q]->dualCut<double, double>(mutex_indicators_stubs);
+            const double dual_objective =
+                m_subschedulers[q]->criticalPathCut<double, double>(m_critical_paths[q], mutex_indicators_stubs);
             if(std::abs(primal_objective - dual_objective) > 1e-3)
             {
                 throw createLogicError(fmt::format("Primal ({}) and Dual ({}) do not have the same objective",
@@ -119,7 +122,9 @@ namespace grstapse
             }
 #endif
 
-            GRBLinExpr dual_cut = m_subschedulers[q]->dualCut<GRBLinExpr, GRBVar>(m_mutex_indicators->indicators());
+            GRBLinExpr dual_cut =
+                m_subschedulers[q]->criticalPathCut<GRBLinExpr, GRBVar>(m_critical_paths[q],
+                                                                        m_mutex_indicators->indicators());
             dual_cut -= M * m_master_y_indicators[q];
             callback.addLazy(m_alpha_robust_makespan >= dual_cut);
         }
@@ -138,11 +143,10 @@ namespace grstapse
                                                                 m_problem_inputs,
                                                                 m_subproblem_mutex_indicators.back(),
                                                                 false));
-            if(std::shared_ptr<MilpSolverResult> result =
-                   m_subschedulers.back()->createModel(m_problem_inputs->schedulerParameters());
-               result->failure())
+            if(std::shared_ptr<const FailureReason> failure_reason = m_subschedulers.back()->setupData();
+               failure_reason)
             {
-                return result->failureReason();
+                return failure_reason;
             }
         }
 
@@ -155,6 +159,7 @@ namespace grstapse
             model.addConstr(m_alpha_robust_makespan >=
                             m_subschedulers[q]->longestFixedChain() * (1.0 - m_master_y_indicators[q]));
         }
+        createPooledCuts(model, m_subschedulers);
         return nullptr;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -36,14 +36,16 @@
 #include "grstapse/common/utilities/timer_runner.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/scheduling/milp/mutex_indicators.hpp"
+#include "grstapse/scheduling/milp/stochastic/benders/benders_cut_pool.hpp"
 #include "grstapse/scheduling/schedule_base.hpp"
 
 namespace grstapse
 {
     BendersStochasticMilpScheduler::BendersStochasticMilpScheduler(
         const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
-        const std::shared_ptr<const SmsNameSchemeBase>& name_scheme)
-        : BendersStochasticMilpSchedulerBase(problem_inputs, name_scheme)
+        const std::shared_ptr<const SmsNameSchemeBase>& name_scheme,
+        const std::shared_ptr<BendersCutPool>& cut_pool)
+        : BendersStochasticMilpSchedulerBase(problem_inputs, name_scheme, cut_pool)
         , m_subproblem_mutex_indicators(std::make_shared<MutexIndicators>(problem_inputs, name_scheme, false))
         , m_subproblem_y_indicators(std::make_shared<std::vector<GRBVar>>(m_num_scenarios))
         , m_subproblem(problem_inputs, m_subproblem_mutex_indicators, m_subproblem_y_indicators, name_scheme)
@@ -55,11 +57,14 @@ namespace grstapse
 #ifdef DEBUG
         std::unordered_map<std::pair<unsigned int, unsigned int>, double> mutex_stubs;
 #endif
+        std::vector<std::pair<unsigned int, unsigned int>> mutex_orderings;
+        mutex_orderings.reserve(m_mutex_indicators->indicators().size());
         for(auto& [p, var]: m_mutex_indicators->indicators())
         {
             const double var_x    = callback.getSolution(var);
             GRBVar& sub_problem_v = m_subproblem_mutex_indicators->get(p);
             fixVariable(sub_problem_v, var_x > 0.5 ? 1.0 : 0.0);
+            mutex_orderings.push_back(var_x > 0.5 ? p : std::pair(p.second, p.first));
 #ifdef DEBUG
             mutex_stubs[p] = var_x > 0.5 ? 1.0 : 0.0;
 #endif
@@ -100,6 +105,15 @@ namespace grstapse
         GRBLinExpr dual_optimality_cut =
             m_subproblem.dualCut<GRBLinExpr, GRBVar>(m_mutex_indicators->indicators(), m_master_y_indicators);
         callback.addLazy(m_alpha_robust_makespan >= dual_optimality_cut);
+
+        // The dual cut is specific to this LP, but the critical chain of each scenario can seed other allocations
+        if(m_cut_pool != nullptr)
+        {
+            for(unsigned int q = 0; q < m_num_scenarios; ++q)
+            {
+                m_cut_pool->add(q, m_subproblem.m_subschedulers[q]->longestPath(mutex_orderings).critical_chain);
+            }
+        }
     }
 
     std::shared_ptr<const FailureReason> BendersStochasticMilpScheduler::setupData()
@@ -115,7 +129,14 @@ namespace grstapse
 
     std::shared_ptr<const FailureReason> BendersStochasticMilpScheduler::createInitialCuts(GRBModel& model)
     {
-        return m_subproblem.createInitialCuts(model, m_alpha_robust_makespan, m_master_y_indicators);
+        if(std::shared_ptr<const FailureReason> failure_reason =
+               m_subproblem.createInitialCuts(model, m_alpha_robust_makespan, m_master_y_indicators);
+           failure_reason)
+        {
+            return failure_reason;
+        }
+        createPooledCuts(model, m_subproblem.m_subschedulers);
+        return nullptr;
     }
 
 }  // namespace grstapse
\ No newline at end of file
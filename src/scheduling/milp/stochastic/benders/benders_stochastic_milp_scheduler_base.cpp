@@ -26,20 +26,24 @@
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/parameters/parameters_base.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
+#include "grstapse/scheduling/milp/deterministic/deterministic_milp_subscheduler.hpp"
 #include "grstapse/scheduling/milp/mutex_indicators.hpp"
+#include "grstapse/scheduling/milp/stochastic/benders/benders_cut_pool.hpp"
 #include "grstapse/scheduling/milp/stochastic/stochastic_schedule.hpp"
 
 namespace grstapse
 {
     BendersStochasticMilpSchedulerBase::BendersStochasticMilpSchedulerBase(
         const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
-        const std::shared_ptr<const SmsNameSchemeBase>& name_scheme)
+        const std::shared_ptr<const SmsNameSchemeBase>& name_scheme,
+        const std::shared_ptr<BendersCutPool>& cut_pool)
         : MilpSchedulerBase(problem_inputs, std::make_shared<MutexIndicators>(problem_inputs, name_scheme), true)
         , m_num_scenarios(problem_inputs->schedulerParameters()->get<unsigned int>(constants::k_num_scenarios))
         , m_alpha_q(m_num_scenarios * problem_inputs->schedulerParameters()->get<float>(constants::k_gamma))
         , m_task_stubs(m_num_scenarios)
         , m_master_y_indicators(m_num_scenarios)
         , m_name_scheme(name_scheme)
+        , m_cut_pool(cut_pool)
     {}
 
     std::shared_ptr<const FailureReason> BendersStochasticMilpSchedulerBase::createTaskVariables(GRBModel& model)
@@ -120,6 +124,31 @@ namespace grstapse
         return nullptr;
     }
 
+    void BendersStochasticMilpSchedulerBase::createPooledCuts(
+        GRBModel& model,
+        const std::vector<std::unique_ptr<DeterministicMilpSubscheduler>>& subschedulers)
+    {
+        if(m_cut_pool == nullptr)
+        {
+            return;
+        }
+
+        const double M = getM();
+        for(unsigned int q = 0; q < m_num_scenarios; ++q)
+        {
+            for(std::vector<unsigned int>& chain: m_cut_pool->validChains(q,
+                                                                          m_problem_inputs->precedenceClosure(),
+                                                                          m_problem_inputs->mutexSet()))
+            {
+                const LongestPathResult longest_path{0.0f, std::move(chain)};
+                auto& indicators = m_mutex_indicators->indicators();
+                GRBLinExpr cut   = subschedulers[q]->criticalPathCut<GRBLinExpr, GRBVar>(longest_path, indicators);
+                cut -= M * m_master_y_indicators[q];
+                model.addConstr(m_alpha_robust_makespan >= cut);
+            }
+        }
+    }
+
     std::shared_ptr<const ScheduleBase> BendersStochasticMilpSchedulerBase::createSchedule(GRBModel& model)
     {
         const double makespan = m_alpha_robust_makespan.get(GRB_DoubleAttr_X);
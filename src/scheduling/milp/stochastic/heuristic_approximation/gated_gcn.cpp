@@ -0,0 +1,303 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/milp/stochastic/heuristic_approximation/gated_gcn.hpp"
+
+// Global
+#include <cmath>
+#include <fstream>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/common/utilities/json_extension.hpp"
+
+namespace grstapse
+{
+    GatedGcn::GatedGcn(const nlohmann::json& j)
+    {
+        json_ext::validateJson(j,
+                               {{constants::k_node_embedding, nlohmann::json::value_t::object},
+                                {constants::k_edge_embedding, nlohmann::json::value_t::object},
+                                {constants::k_layers, nlohmann::json::value_t::array},
+                                {constants::k_readout_layers, nlohmann::json::value_t::array},
+                                {constants::k_readout, nlohmann::json::value_t::string},
+                                {constants::k_batch_norm, nlohmann::json::value_t::boolean},
+                                {constants::k_residual, nlohmann::json::value_t::boolean},
+                                {constants::k_use_edge_features, nlohmann::json::value_t::boolean}});
+        m_node_embedding    = linearFromJson(j[constants::k_node_embedding]);
+        m_edge_embedding    = linearFromJson(j[constants::k_edge_embedding]);
+        m_batch_norm        = j[constants::k_batch_norm].get<bool>();
+        m_residual          = j[constants::k_residual].get<bool>();
+        m_use_edge_features = j[constants::k_use_edge_features].get<bool>();
+
+        // Same as the python model, anything unknown is a mean readout
+        const std::string readout = j[constants::k_readout].get<std::string>();
+        if(readout == "sum")
+        {
+            m_readout = Readout::e_sum;
+        }
+        else if(readout == "max")
+        {
+            m_readout = Readout::e_max;
+        }
+        else
+        {
+            m_readout = Readout::e_mean;
+        }
+
+        const unsigned int hidden_dimension = hiddenDimension();
+        if(m_edge_embedding.weight.rows() != hidden_dimension)
+        {
+            throw createLogicError("The node and edge embeddings have different dimensions");
+        }
+
+        for(const nlohmann::json& layer_j: j[constants::k_layers])
+        {
+            Layer layer{.node_self        = linearFromJson(layer_j.at(constants::k_node_self)),
+                        .node_neighbor    = linearFromJson(layer_j.at(constants::k_node_neighbor)),
+                        .edge_self        = linearFromJson(layer_j.at(constants::k_edge_self)),
+                        .edge_source      = linearFromJson(layer_j.at(constants::k_edge_source)),
+                        .edge_destination = linearFromJson(layer_j.at(constants::k_edge_destination))};
+            for(const Linear* linear: {&layer.node_self,
+                                       &layer.node_neighbor,
+                                       &layer.edge_self,
+                                       &layer.edge_source,
+                                       &layer.edge_destination})
+            {
+                if(linear->weight.rows() != hidden_dimension || linear->weight.cols() != hidden_dimension)
+                {
+                    throw createLogicError("Gated graph convolution layers must map the hidden dimension to itself");
+                }
+            }
+            if(m_batch_norm)
+            {
+                layer.node_batch_norm = batchNormFromJson(layer_j.at(constants::k_node_batch_norm));
+                layer.edge_batch_norm = batchNormFromJson(layer_j.at(constants::k_edge_batch_norm));
+                if(layer.node_batch_norm.scale.size() != hidden_dimension ||
+                   layer.edge_batch_norm.scale.size() != hidden_dimension)
+                {
+                    throw createLogicError("Batch normalization does not match the hidden dimension");
+                }
+            }
+            m_layers.push_back(std::move(layer));
+        }
+
+        for(const nlohmann::json& linear_j: j[constants::k_readout_layers])
+        {
+            m_readout_layers.push_back(linearFromJson(linear_j));
+        }
+        if(m_readout_layers.empty() || m_readout_layers.front().weight.cols() != hidden_dimension + 1 ||
+           m_readout_layers.back().weight.rows() != 1)
+        {
+            throw createLogicError("The readout must map the hidden dimension and alpha to a single value");
+        }
+        for(unsigned int i = 1; i < m_readout_layers.size(); ++i)
+        {
+            if(m_readout_layers[i].weight.cols() != m_readout_layers[i - 1].weight.rows())
+            {
+                throw createLogicError(fmt::format("Readout layer {0:d} has the wrong input dimension", i));
+            }
+        }
+    }
+
+    GatedGcn GatedGcn::load(const std::string& filepath)
+    {
+        std::ifstream fin(filepath);
+        if(not fin)
+        {
+            throw createLogicError(fmt::format("Cannot open GNN weights '{0:s}'", filepath));
+        }
+        nlohmann::json j;
+        fin >> j;
+        return GatedGcn(j);
+    }
+
+    std::vector<float> GatedGcn::predict(unsigned int num_nodes,
+                                         std::span<const std::pair<unsigned int, unsigned int>> edges,
+                                         const Matrix& node_features,
+                                         const Matrix& edge_features,
+                                         float alpha) const
+    {
+        const unsigned int num_edges = edges.size();
+        if(num_nodes == 0 || node_features.rows() % num_nodes != 0)
+        {
+            throw createLogicError("The node features are not a whole number of graphs");
+        }
+        const unsigned int num_graphs = node_features.rows() / num_nodes;
+        if(edge_features.rows() != num_graphs * num_edges)
+        {
+            throw createLogicError("The number of edge features does not match the number of edges");
+        }
+        if(node_features.cols() != m_node_embedding.weight.cols() ||
+           (m_use_edge_features && edge_features.cols() != m_edge_embedding.weight.cols()))
+        {
+            throw createLogicError("The features do not match the dimensions of the model");
+        }
+        for(const auto& [source, destination]: edges)
+        {
+            if(source >= num_nodes || destination >= num_nodes)
+            {
+                throw createLogicError(fmt::format("Edge ({0:d}, {1:d}) is out of bounds", source, destination));
+            }
+        }
+
+        // Every graph is stacked into the same matrices, so each linear layer is a single matrix product for the batch
+        Matrix h = m_node_embedding(node_features);
+        Matrix e = m_edge_embedding(m_use_edge_features ? edge_features : Matrix::Ones(edge_features.rows(), 1));
+        for(const Layer& layer: m_layers)
+        {
+            const Matrix self        = layer.node_self(h);
+            const Matrix neighbor    = layer.node_neighbor(h);
+            const Matrix source      = layer.edge_source(h);
+            const Matrix destination = layer.edge_destination(h);
+            Matrix next_e            = layer.edge_self(e);
+
+            // Each destination aggregates its incoming neighbors weighted by the sigmoid of the edge gate
+            Matrix numerator   = Matrix::Zero(h.rows(), h.cols());
+            Matrix denominator = Matrix::Zero(h.rows(), h.cols());
+#pragma omp parallel for schedule(static)
+            for(int graph = 0; graph < static_cast<int>(num_graphs); ++graph)
+            {
+                const unsigned int node_offset = graph * num_nodes;
+                const unsigned int edge_offset = graph * num_edges;
+                Eigen::RowVectorXf sigma(h.cols());
+                for(unsigned int k = 0; k < num_edges; ++k)
+                {
+                    const unsigned int u = node_offset + edges[k].first;
+                    const unsigned int v = node_offset + edges[k].second;
+                    auto edge            = next_e.row(edge_offset + k);
+                    edge += source.row(u) + destination.row(v);
+                    sigma = (1.0f + (-edge.array()).exp()).inverse().matrix();
+                    numerator.row(v) += neighbor.row(u).cwiseProduct(sigma);
+                    denominator.row(v) += sigma;
+                }
+            }
+            Matrix next_h = self + (numerator.array() / (denominator.array() + 1e-6f)).matrix();
+
+            if(m_batch_norm)
+            {
+                layer.node_batch_norm(next_h);
+                layer.edge_batch_norm(next_e);
+            }
+            next_h = next_h.cwiseMax(0.0f);
+            next_e = next_e.cwiseMax(0.0f);
+            if(m_residual)
+            {
+                next_h += h;
+                next_e += e;
+            }
+            h = std::move(next_h);
+            e = std::move(next_e);
+        }
+
+        const unsigned int hidden_dimension = hiddenDimension();
+        Matrix y(num_graphs, hidden_dimension + 1);
+        for(unsigned int graph = 0; graph < num_graphs; ++graph)
+        {
+            const auto nodes = h.middleRows(graph * num_nodes, num_nodes);
+            switch(m_readout)
+            {
+                case Readout::e_sum:
+                {
+                    y.row(graph).head(hidden_dimension) = nodes.colwise().sum();
+                    break;
+                }
+                case Readout::e_max:
+                {
+                    y.row(graph).head(hidden_dimension) = nodes.colwise().maxCoeff();
+                    break;
+                }
+                case Readout::e_mean:
+                {
+                    y.row(graph).head(hidden_dimension) = nodes.colwise().mean();
+                    break;
+                }
+            }
+            y(graph, hidden_dimension) = alpha;
+        }
+        for(unsigned int i = 0; i < m_readout_layers.size(); ++i)
+        {
+            y = m_readout_layers[i](y);
+            if(i + 1 < m_readout_layers.size())
+            {
+                y = y.cwiseMax(0.0f);
+            }
+        }
+
+        std::vector<float> rv(num_graphs);
+        for(unsigned int graph = 0; graph < num_graphs; ++graph)
+        {
+            rv[graph] = 1.0f / (1.0f + std::exp(-y(graph, 0)));
+        }
+        return rv;
+    }
+
+    GatedGcn::Matrix GatedGcn::Linear::operator()(const Matrix& x) const
+    {
+        Matrix y = x * weight.transpose();
+        y.rowwise() += bias;
+        return y;
+    }
+
+    void GatedGcn::BatchNorm::operator()(Matrix& x) const
+    {
+        x.array().rowwise() *= scale.array();
+        x.rowwise() += shift;
+    }
+
+    GatedGcn::Linear GatedGcn::linearFromJson(const nlohmann::json& j)
+    {
+        json_ext::validateJson(j,
+                               {{constants::k_weight, nlohmann::json::value_t::array},
+                                {constants::k_bias, nlohmann::json::value_t::array}});
+        Linear rv;
+        rv.weight = j[constants::k_weight].get<Matrix>();
+        rv.bias   = j[constants::k_bias].get<Eigen::VectorXf>().transpose();
+        if(rv.bias.size() != rv.weight.rows())
+        {
+            throw createLogicError("The bias and weight of a linear layer have different dimensions");
+        }
+        return rv;
+    }
+
+    GatedGcn::BatchNorm GatedGcn::batchNormFromJson(const nlohmann::json& j)
+    {
+        json_ext::validateJson(j,
+                               {{constants::k_weight, nlohmann::json::value_t::array},
+                                {constants::k_bias, nlohmann::json::value_t::array},
+                                {constants::k_running_mean, nlohmann::json::value_t::array},
+                                {constants::k_running_var, nlohmann::json::value_t::array},
+                                {constants::k_eps, nlohmann::json::value_t::number_float}});
+        const Eigen::VectorXf weight       = j[constants::k_weight].get<Eigen::VectorXf>();
+        const Eigen::VectorXf bias         = j[constants::k_bias].get<Eigen::VectorXf>();
+        const Eigen::VectorXf running_mean = j[constants::k_running_mean].get<Eigen::VectorXf>();
+        const Eigen::VectorXf running_var  = j[constants::k_running_var].get<Eigen::VectorXf>();
+        const float eps                    = j[constants::k_eps].get<float>();
+
+        BatchNorm rv;
+        rv.scale = (weight.array() / (running_var.array() + eps).sqrt()).matrix().transpose();
+        rv.shift = (bias.array() - running_mean.array() * rv.scale.transpose().array()).matrix().transpose();
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -222,7 +222,7 @@ namespace grstapse
                          transitions_info.transitionDurationLowerBound(predecessor, successor));
                 edge_feature_list.append(std::move(l));
             }
-            for(auto [i, j]: m_problem_inputs->mutexConstraints())
+            for(auto [i, j]: m_problem_inputs->mutexSet().constraints())
             {
                 if(precedence_constraints.contains({i, j}) or precedence_constraints.contains({j, i}))
                 {
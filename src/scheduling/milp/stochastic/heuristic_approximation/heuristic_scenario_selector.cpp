@@ -23,30 +23,39 @@
 #include "grstapse/scheduling/milp/stochastic/heuristic_approximation/heuristic_scenario_selector.hpp"
 
 // Global
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <limits>
 #include <memory>
-#include <random>
+#include <mutex>
+#include <numeric>
 #include <set>
 // External
-#include <range/v3/range/conversion.hpp>
-#include <range/v3/view/enumerate.hpp>
-#include <range/v3/view/filter.hpp>
-#include <range/v3/view/map.hpp>
-#include <range/v3/view/take.hpp>
+#include <fmt/format.h>
 // Local
+#include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/time_keeper.hpp"
 #include "grstapse/common/utilities/timeout_failure.hpp"
 #include "grstapse/common/utilities/timer.hpp"
 #include "grstapse/geometric_planning/environments/euclidean_graph_environment.hpp"
 #include "grstapse/geometric_planning/environments/sampled_euclidean_graph_environment.hpp"
 #include "grstapse/geometric_planning/motion_planners/masked_complete_sampled_euclidean_graph_motion_planner.hpp"
+#include "grstapse/parameters/parameters_base.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
+#include "grstapse/scheduling/milp/stochastic/scenario_reduction.hpp"
 
 namespace grstapse
 {
     HeuristicScenarioSelector::HeuristicScenarioSelector(
         const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs)
         : ScenarioSelectorBase(problem_inputs)
-    {}
+    {
+        const std::shared_ptr<const ParametersBase>& parameters = m_problem_inputs->schedulerParameters();
+        m_random_engine.seed(parameters->contains(constants::k_seed) ? parameters->get<unsigned int>(constants::k_seed)
+                                                                     : std::random_device()());
+    }
 
     std::optional<std::vector<bool>> HeuristicScenarioSelector::createMask(
         Timer& timer,
@@ -56,133 +65,159 @@ namespace grstapse
         float gamma,
         float timeout)
     {
-        std::vector<std::pair<unsigned int, unsigned int>> task_edges;
-        std::vector<std::pair<unsigned int, unsigned int>> precedence_transition_edges;
-        std::vector<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>> mutex_transition_edges;
-
-        task_edges.reserve(m_problem_inputs->numberOfPlanTasks());
-        for(auto task: m_problem_inputs->planTasks())
-        {
-            task_edges.emplace_back(ScenarioSelectorBase::getEdge(task));
-        }
-
-        //        const auto& precedence_constraints = m_problem_inputs->precedenceConstraints();
-        //
-        //        precedence_transition_edges.reserve(precedence_constraints.size());
-        //        mutex_transition_edges.reserve(m_problem_inputs->mutexConstraints().size());
-        //        for(const auto [i, j]: m_problem_inputs->mutexConstraints())
-        //        {
-        //            if(precedence_constraints.contains({i, j}))
-        //            {
-        //                precedence_transition_edges.emplace_back(getEdge(i, j));
-        //            }
-        //            else if(precedence_constraints.contains({j, i}))
-        //            {
-        //                precedence_transition_edges.emplace_back(getEdge(j, i));
-        //            }
-        //            else
-        //            {
-        //                auto i_to_j = getEdge(i, j);
-        //                auto j_to_i = getEdge(j, i);
-        //                mutex_transition_edges.emplace_back(
-        //                    std::tuple{i_to_j.first, i_to_j.second, j_to_i.first, j_to_i.second});
-        //            }
-        //        }
+        const std::vector<float> scenario_labels = labels(
+            *std::dynamic_pointer_cast<SampledEuclideanGraphEnvironment>(motion_planner->environment()),
+            num_samples);
         if(timer.get() > timeout)
         {
             // Log one level up
             return std::nullopt;
         }
 
-        std::set<std::pair<float, unsigned int>> label_map =
-            std::dynamic_pointer_cast<SampledEuclideanGraphEnvironment>(motion_planner->environment())->graphs() |
-            ::ranges::views::take(num_samples) |
-            ::ranges::views::transform(
-                [this, &task_edges, &precedence_transition_edges, &mutex_transition_edges](
-                    const std::shared_ptr<EuclideanGraphEnvironment>& environment) -> float
-                {
-                    return this->label(environment, task_edges, precedence_transition_edges, mutex_transition_edges);
-                }) |
-            ::ranges::views::enumerate |
-            ::ranges::views::transform(
-                [](auto&& p) -> std::pair<float, unsigned int>
-                {
-                    return {p.second, p.first};
-                }) |
-            ::ranges::to<std::set>();
-        if(timer.get() > timeout)
+        // Only the set of the num_h lowest labels (and which is the largest) matters, so a partial ordering is enough
+        const unsigned int num_h = static_cast<unsigned int>(num_samples * (1.0 - gamma) + 0.5);
+        if(num_h == 0)
         {
-            return std::nullopt;
+            throw createLogicError(
+                fmt::format("Gamma ({0:f}) leaves none of the {1:d} scenarios in the H set", gamma, num_samples));
         }
+        std::vector<unsigned int> order(num_samples);
+        std::iota(order.begin(), order.end(), 0u);
+        std::nth_element(order.begin(),
+                         order.begin() + (num_h - 1),
+                         order.end(),
+                         [&scenario_labels](unsigned int lhs, unsigned int rhs) -> bool
+                         {
+                             return std::pair(scenario_labels[lhs], lhs) < std::pair(scenario_labels[rhs], rhs);
+                         });
 
-        const unsigned int num_h = static_cast<unsigned int>(num_samples * (1.0 - gamma) + 0.5);
         std::set<unsigned int> sampled;
+        if(m_problem_inputs->schedulerParameters()->get<unsigned int>(constants::k_num_reduced_scenarios) > 0)
+        {
+            // Select scenarios that represent the whole H set instead of sampling it
+            const std::vector<unsigned int> graph_indices(order.begin(), order.begin() + num_h);
+            const std::vector<std::vector<float>> durations = scenarioDurationVectors(
+                *m_problem_inputs,
+                *std::dynamic_pointer_cast<SampledEuclideanGraphEnvironment>(motion_planner->environment()),
+                graph_indices);
+            const std::array<unsigned int, 1> required = {num_h - 1};
+            for(unsigned int i: reduceScenarios(durations, std::min(beta, num_h), required).indices)
+            {
+                sampled.insert(i);
+            }
+            if(timer.get() > timeout)
+            {
+                return std::nullopt;
+            }
+        }
+        else
         {
-            std::random_device random_device;
-            std::default_random_engine random_engine(random_device());
             std::uniform_int_distribution<unsigned int> uniform_int_distribution(0, num_h - 1);
             sampled.insert(num_h - 1);
-            while(sampled.size() < beta)
+            while(sampled.size() < std::min(beta, num_h))
             {
-                sampled.insert(uniform_int_distribution(random_engine));
+                sampled.insert(uniform_int_distribution(m_random_engine));
             }
         }
 
         std::vector<bool> mask(num_samples, false);
-        for(unsigned int i: label_map | ::ranges::views::take(num_h) | ::ranges::views::enumerate |
-                                ::ranges::views::filter(
-                                    [&sampled](auto&& p) -> bool
-                                    {
-                                        return sampled.contains(p.first);
-                                    }) |
-                                ::ranges::views::values | ::ranges::views::values)
+        for(unsigned int i: sampled)
         {
-            mask[i] = true;
+            mask[order[i]] = true;
         }
         return mask;
     }
 
-    float HeuristicScenarioSelector::label(
-        const std::shared_ptr<EuclideanGraphEnvironment>& environment,
-        std::vector<std::pair<unsigned int, unsigned int>> task_edges,
-        std::vector<std::pair<unsigned int, unsigned int>> precedence_transition_edges,
-        std::vector<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>> mutex_transition_edges) const
+    std::vector<float> HeuristicScenarioSelector::labels(const SampledEuclideanGraphEnvironment& environment,
+                                                         unsigned int num_samples) const
     {
-        float rv = 0.0f;
-        for(auto [task_nr, edge_ids]: task_edges | ::ranges::view::enumerate)
+        // Every scenario shares the static durations and the edge each task travels along, only the edge costs differ
+        float static_duration = 0.0f;
+        std::vector<std::pair<unsigned int, unsigned int>> task_edges;
+        std::vector<float> inverse_speeds;
+        task_edges.reserve(m_problem_inputs->numberOfPlanTasks());
+        inverse_speeds.reserve(m_problem_inputs->numberOfPlanTasks());
+        for(unsigned int task_nr = 0, num_tasks = m_problem_inputs->numberOfPlanTasks(); task_nr < num_tasks; ++task_nr)
         {
-            rv += m_problem_inputs->planTask(task_nr)->staticDuration();
-            const auto [i, j] = edge_ids;
+            static_duration += m_problem_inputs->planTask(task_nr)->staticDuration();
 
             // No travel during task
-            if(i == j)
+            const std::pair<unsigned int, unsigned int> edge = getEdge(task_nr);
+            if(edge.first == edge.second)
             {
                 continue;
             }
 
             float speed = std::numeric_limits<float>::max();
-            for(auto robot: m_problem_inputs->coalition(task_nr))
+            for(const std::shared_ptr<const Robot>& robot: m_problem_inputs->coalition(task_nr))
             {
                 speed = std::min(speed, robot->speed());
             }
+            // Nobody travels
+            if(speed == std::numeric_limits<float>::max())
+            {
+                continue;
+            }
 
             // Weight by number of robots?
-            rv += environment->findEdge(i, j)->cost() / speed;
+            task_edges.push_back(edge);
+            inverse_speeds.push_back(1.0f / speed);
         }
 
-        //        for(auto [i, j]: m_precedence_transition_edges)
-        //        {
-        //            rv += environment->findPossibleEdge(i, j)->cost();
-        //        }
-        //
-        //        for(auto [i, j, k, l]: m_mutex_trasition_edges)
-        //        {
-        //            // weight by number of robots?
-        //            const float i_to_j_cost = environment->findPossibleEdge(i, j)->cost();
-        //            const float j_to_i_cost = environment->findPossibleEdge(k, l)->cost();
-        //            rv += 0.5 * i_to_j_cost + 0.5 * j_to_i_cost;
-        //        }
+        // Gather the edge costs into an edge major matrix so the labels can be computed with contiguous loads
+        const unsigned int num_edges = task_edges.size();
+        std::vector<float> costs(static_cast<std::size_t>(num_edges) * num_samples);
+        {
+            // Exceptions cannot propagate out of an OpenMP region, so the first one is rethrown afterwards
+            std::exception_ptr exception = nullptr;
+            std::mutex exception_mutex;
+#pragma omp parallel for schedule(static) shared(exception, exception_mutex)
+            for(int scenario = 0; scenario < static_cast<int>(num_samples); ++scenario)
+            {
+                try
+                {
+                    const std::shared_ptr<EuclideanGraphEnvironment>& graph = environment.graphs()[scenario];
+                    for(unsigned int e = 0; e < num_edges; ++e)
+                    {
+                        costs[static_cast<std::size_t>(e) * num_samples + scenario] =
+                            graph->findEdge(task_edges[e].first, task_edges[e].second)->cost();
+                    }
+                }
+                catch(...)
+                {
+                    std::lock_guard lock(exception_mutex);
+                    if(exception == nullptr)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if(exception != nullptr)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
 
+        std::vector<float> rv(num_samples, static_duration);
+        constexpr unsigned int k_block_size = 256;
+        const int num_blocks                = static_cast<int>((num_samples + k_block_size - 1) / k_block_size);
+#pragma omp parallel for schedule(static)
+        for(int block = 0; block < num_blocks; ++block)
+        {
+            const unsigned int begin = block * k_block_size;
+            const unsigned int end   = std::min(begin + k_block_size, num_samples);
+            float* labels            = rv.data();
+            for(unsigned int e = 0; e < num_edges; ++e)
+            {
+                const float inverse_speed = inverse_speeds[e];
+                const float* edge_costs   = costs.data() + static_cast<std::size_t>(e) * num_samples;
+#pragma omp simd
+                for(unsigned int scenario = begin; scenario < end; ++scenario)
+                {
+                    labels[scenario] += edge_costs[scenario] * inverse_speed;
+                }
+            }
+        }
         return rv;
     }
 }  // namespace grstapse
\ No newline at end of file
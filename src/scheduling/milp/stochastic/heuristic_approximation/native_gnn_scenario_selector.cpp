@@ -0,0 +1,182 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/milp/stochastic/heuristic_approximation/native_gnn_scenario_selector.hpp"
+
+// Global
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <numeric>
+// Local
+#include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/common/utilities/metrics.hpp"
+#include "grstapse/common/utilities/timer.hpp"
+#include "grstapse/parameters/parameters_base.hpp"
+#include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
+#include "grstapse/scheduling/milp/deterministic/dms_all_tasks_info.hpp"
+#include "grstapse/scheduling/milp/deterministic/dms_all_transitions_info.hpp"
+#include "grstapse/scheduling/milp/deterministic/subscheduler_motion_planner_interface.hpp"
+#include "grstapse/scheduling/milp/mutex_indicators.hpp"
+#include "grstapse/scheduling/mutex_set.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! \returns The model stored at \p filepath (loaded once per process)
+        std::shared_ptr<const GatedGcn> loadModel(const std::string& filepath)
+        {
+            static std::mutex mutex;
+            static std::map<std::string, std::shared_ptr<const GatedGcn>> models;
+
+            std::lock_guard lock(mutex);
+            std::shared_ptr<const GatedGcn>& model = models[filepath];
+            if(model == nullptr)
+            {
+                Logger::info("Loading model: {0:s}", filepath);
+                model = std::make_shared<const GatedGcn>(GatedGcn::load(filepath));
+            }
+            return model;
+        }
+    }  // namespace
+
+    NativeGnnScenarioSelector::NativeGnnScenarioSelector(
+        const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs)
+        : ScenarioSelectorBase(problem_inputs)
+        , m_model(loadModel(problem_inputs->schedulerParameters()->get<std::string>(constants::k_gnn_weights_filepath)))
+    {
+        const auto& precedence_constraints = m_problem_inputs->precedenceConstraints();
+        const std::vector<std::pair<unsigned int, unsigned int>> mutex_constraints =
+            m_problem_inputs->mutexSet().unorderedConstraints(m_problem_inputs->precedenceClosure());
+        m_num_precedence_edges = precedence_constraints.size();
+        m_edges.reserve(m_num_precedence_edges + 2 * mutex_constraints.size());
+        m_edges.insert(m_edges.end(), precedence_constraints.begin(), precedence_constraints.end());
+        for(const auto& [i, j]: mutex_constraints)
+        {
+            m_edges.emplace_back(i, j);
+            m_edges.emplace_back(j, i);
+        }
+    }
+
+    std::optional<std::vector<bool>> NativeGnnScenarioSelector::createMask(
+        Timer& timer,
+        const std::shared_ptr<MaskedCompleteSampledEuclideanGraphMotionPlanner>& motion_planner,
+        unsigned int num_samples,
+        unsigned int beta,
+        float gamma,
+        float timeout)
+    {
+        GatedGcn::Matrix node_features;
+        GatedGcn::Matrix edge_features;
+        computeFeatures(num_samples, node_features, edge_features);
+        if(timer.get() > timeout)
+        {
+            // Log one level up
+            return std::nullopt;
+        }
+
+        const std::vector<float> predictions =
+            m_model->predict(m_problem_inputs->numberOfPlanTasks(), m_edges, node_features, edge_features, gamma);
+
+        // Select the beta scenarios with the highest predictions
+        const unsigned int num_selected = std::min(beta, num_samples);
+        std::vector<unsigned int> order(num_samples);
+        std::iota(order.begin(), order.end(), 0u);
+        std::nth_element(order.begin(),
+                         order.begin() + num_selected,
+                         order.end(),
+                         [&predictions](unsigned int lhs, unsigned int rhs) -> bool
+                         {
+                             return std::pair(predictions[lhs], lhs) > std::pair(predictions[rhs], rhs);
+                         });
+
+        std::vector<bool> rv(num_samples, false);
+        for(unsigned int i = 0; i < num_selected; ++i)
+        {
+            rv[order[i]] = true;
+        }
+        return rv;
+    }
+
+    void NativeGnnScenarioSelector::computeFeatures(unsigned int num_samples,
+                                                    GatedGcn::Matrix& node_features,
+                                                    GatedGcn::Matrix& edge_features) const
+    {
+        const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+        const unsigned int num_edges = m_edges.size();
+        node_features.resize(num_samples * num_tasks, 1);
+        edge_features.resize(num_samples * num_edges, 2);
+
+        // Only read when setting up the transitions, so it is shared by every scenario
+        auto mutex_indicators = std::make_shared<MutexIndicators>(m_problem_inputs, nullptr);
+
+        // Exceptions cannot propagate out of an OpenMP region, so the first one is rethrown afterwards
+        std::exception_ptr exception = nullptr;
+        std::mutex exception_mutex;
+        // Workers record their timings/counts into the same metrics as this thread
+        Metrics& metrics = Metrics::current();
+#pragma omp parallel for schedule(dynamic, 1) shared(exception, exception_mutex)
+        for(int q = 0; q < static_cast<int>(num_samples); ++q)
+        {
+            try
+            {
+                Metrics::Activation activation(metrics);
+                auto motion_planner_interface = std::make_shared<const SubschedulerMotionPlannerInterface>(q);
+                DmsAllTasksInfo tasks_info(m_problem_inputs, nullptr, motion_planner_interface);
+                tasks_info.setupData();
+                for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+                {
+                    node_features(q * num_tasks + task_nr, 0) = tasks_info.taskLowerBound(task_nr);
+                }
+
+                DmsAllTransitionsInfo transitions_info(tasks_info,
+                                                       m_problem_inputs,
+                                                       mutex_indicators,
+                                                       nullptr,
+                                                       motion_planner_interface);
+                transitions_info.setupData();
+                for(unsigned int k = 0; k < num_edges; ++k)
+                {
+                    const auto [i, j]                   = m_edges[k];
+                    edge_features(q * num_edges + k, 0) = k < m_num_precedence_edges ? 0.0f : 1.0f;
+                    edge_features(q * num_edges + k, 1) =
+                        tasks_info.taskDuration(i) + transitions_info.transitionDurationLowerBound(i, j);
+                }
+            }
+            catch(...)
+            {
+                std::lock_guard lock(exception_mutex);
+                if(exception == nullptr)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if(exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -23,7 +23,9 @@
 #include "grstapse/scheduling/milp/stochastic/heuristic_approximation/sequential_probability_ratio_test.hpp"
 
 // Global
+#include <algorithm>
 #include <cmath>
+#include <vector>
 // Local
 #include "grstapse/common/utilities/logger.hpp"
 
@@ -115,6 +117,54 @@ namespace grstapse
         return false;
     }
 
+    bool SequentialProbabilityRatioTest::run(float reference_value, std::span<const float> samples) const
+    {
+        return run(reference_value, samples.size(), yieldSamples(samples));
+    }
+
+    std::optional<float> SequentialProbabilityRatioTest::minimumAcceptedReference(
+        float lower_bound,
+        std::span<const float> samples) const
+    {
+        if(run(lower_bound, samples))
+        {
+            return lower_bound;
+        }
+
+        std::vector<float> candidates;
+        candidates.reserve(samples.size());
+        for(const float value: samples)
+        {
+            if(value > lower_bound && std::isfinite(value))
+            {
+                candidates.push_back(value);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        // The candidates are partitioned into rejected followed by accepted
+        auto iter = std::partition_point(candidates.begin(),
+                                         candidates.end(),
+                                         [this, samples](float candidate) -> bool
+                                         {
+                                             return !run(candidate, samples);
+                                         });
+        if(iter == candidates.end())
+        {
+            return std::nullopt;
+        }
+        return *iter;
+    }
+
+    cppcoro::generator<float> SequentialProbabilityRatioTest::yieldSamples(std::span<const float> samples)
+    {
+        for(const float value: samples)
+        {
+            co_yield value;
+        }
+    }
+
     float SequentialProbabilityRatioTest::getAcceptanceNumber(float inspected_samples) const
     {
         return m_acceptance_first_term + inspected_samples * m_second_term;
@@ -53,7 +53,7 @@ namespace grstapse
         {
             m_subschedulers[q]->createObjectiveConstraints(model);
 
-            y_summation += m_y_indicators->at(q);
+            y_summation += scenarioMultiplicity(q) * m_y_indicators->at(q);
 
             model.addConstr(m_subschedulers[q]->makespanVariable() - m_makespan - M * m_y_indicators->at(q) <= 0,
                             m_name_scheme->createYConstraintName(q));
@@ -66,11 +66,12 @@ namespace grstapse
                                                                                        float timeout,
                                                                                        float gamma)
     {
-        return nullptr;
+        return createReducedMask(timer, timeout);
     }
 
     unsigned int MonolithicStochasticMilpScheduler::numFScenarios() const
     {
-        return m_num_scenarios;
+        // m_num_scenarios is smaller if the F set has been reduced
+        return m_problem_inputs->schedulerParameters()->get<unsigned int>(constants::k_num_scenarios);
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,260 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/milp/stochastic/scenario_reduction.hpp"
+
+// Global
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/geometric_planning/configurations/euclidean_graph_configuration.hpp"
+#include "grstapse/geometric_planning/environments/euclidean_graph_environment.hpp"
+#include "grstapse/geometric_planning/environments/sampled_euclidean_graph_environment.hpp"
+#include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
+#include "grstapse/robot.hpp"
+#include "grstapse/scheduling/mutex_set.hpp"
+#include "grstapse/task.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! An edge traversed by a task or transition and the speed it is traversed at
+        struct TravelFeature
+        {
+            unsigned int from;
+            unsigned int to;
+            float speed;
+        };
+
+        [[nodiscard]] unsigned int configurationId(const std::shared_ptr<const ConfigurationBase>& configuration)
+        {
+            return std::dynamic_pointer_cast<const EuclideanGraphConfiguration>(configuration)->id();
+        }
+
+        //! Adds a feature unless it is the same for every graph (no travel or no robots)
+        void addFeature(std::vector<TravelFeature>& features,
+                        unsigned int from,
+                        unsigned int to,
+                        CoalitionView coalition)
+        {
+            if(from == to)
+            {
+                return;
+            }
+
+            float speed = std::numeric_limits<float>::max();
+            for(const std::shared_ptr<const Robot>& robot: coalition)
+            {
+                speed = std::min(speed, robot->speed());
+            }
+            if(speed == std::numeric_limits<float>::max())
+            {
+                return;
+            }
+            features.push_back({.from = from, .to = to, .speed = speed});
+        }
+
+        void addTransitionFeature(std::vector<TravelFeature>& features,
+                                  const SchedulerProblemInputs& problem_inputs,
+                                  unsigned int predecessor,
+                                  unsigned int successor)
+        {
+            addFeature(features,
+                       configurationId(problem_inputs.planTask(predecessor)->terminalConfiguration()),
+                       configurationId(problem_inputs.planTask(successor)->initialConfiguration()),
+                       problem_inputs.transitionCoalition(predecessor, successor));
+        }
+    }  // namespace
+
+    std::vector<std::vector<float>> scenarioDurationVectors(const SchedulerProblemInputs& problem_inputs,
+                                                            const SampledEuclideanGraphEnvironment& environment,
+                                                            std::span<const unsigned int> graph_indices)
+    {
+        // The features only depend on the allocation, so they are found once and evaluated on each graph
+        std::vector<TravelFeature> features;
+        for(unsigned int task_nr = 0, num_tasks = problem_inputs.numberOfPlanTasks(); task_nr < num_tasks; ++task_nr)
+        {
+            const std::shared_ptr<const Task>& task = problem_inputs.planTask(task_nr);
+            addFeature(features,
+                       configurationId(task->initialConfiguration()),
+                       configurationId(task->terminalConfiguration()),
+                       problem_inputs.coalition(task_nr));
+        }
+        for(const auto& [predecessor, successor]: problem_inputs.precedenceConstraints())
+        {
+            addTransitionFeature(features, problem_inputs, predecessor, successor);
+        }
+        for(const auto& [i, j]: problem_inputs.mutexSet().unorderedConstraints(problem_inputs.precedenceClosure()))
+        {
+            addTransitionFeature(features, problem_inputs, i, j);
+            addTransitionFeature(features, problem_inputs, j, i);
+        }
+
+        std::vector<std::vector<float>> rv;
+        rv.reserve(graph_indices.size());
+        for(unsigned int graph_index: graph_indices)
+        {
+            const std::shared_ptr<EuclideanGraphEnvironment>& graph = environment.graphs()[graph_index];
+            std::vector<float>& durations                           = rv.emplace_back();
+            durations.reserve(features.size());
+            for(const TravelFeature& feature: features)
+            {
+                durations.push_back(graph->findEdge(feature.from, feature.to)->cost() / feature.speed);
+            }
+        }
+        return rv;
+    }
+
+    ReducedScenarios reduceScenarios(const std::vector<std::vector<float>>& scenarios,
+                                     unsigned int num_selected,
+                                     std::span<const unsigned int> required)
+    {
+        const unsigned int num_scenarios = scenarios.size();
+        if(num_selected == 0 || num_selected > num_scenarios)
+        {
+            throw createLogicError(fmt::format("Cannot select {0:d} of {1:d} scenarios", num_selected, num_scenarios));
+        }
+        if(required.size() > num_selected)
+        {
+            throw createLogicError("More scenarios are required than selected");
+        }
+        for(const std::vector<float>& scenario: scenarios)
+        {
+            if(scenario.size() != scenarios.front().size())
+            {
+                throw createLogicError("Scenarios have different dimensions");
+            }
+        }
+
+        // Pairwise L1 distances between the scenarios
+        std::vector<float> distances(num_scenarios * num_scenarios, 0.0f);
+#pragma omp parallel for schedule(dynamic, 1)
+        for(int i = 0; i < static_cast<int>(num_scenarios); ++i)
+        {
+            for(unsigned int j = i + 1; j < num_scenarios; ++j)
+            {
+                float distance = 0.0f;
+                for(unsigned int f = 0, end = scenarios[i].size(); f < end; ++f)
+                {
+                    distance += std::abs(scenarios[i][f] - scenarios[j][f]);
+                }
+                distances[i * num_scenarios + j] = distance;
+                distances[j * num_scenarios + i] = distance;
+            }
+        }
+
+        // Distance from each scenario to the closest selected scenario
+        std::vector<float> closest(num_scenarios, std::numeric_limits<float>::infinity());
+        std::vector<bool> selected(num_scenarios, false);
+        unsigned int num_chosen = 0;
+        auto select             = [&](unsigned int u)
+        {
+            selected[u] = true;
+            ++num_chosen;
+            for(unsigned int i = 0; i < num_scenarios; ++i)
+            {
+                closest[i] = std::min(closest[i], distances[i * num_scenarios + u]);
+            }
+        };
+
+        for(unsigned int u: required)
+        {
+            if(u >= num_scenarios)
+            {
+                throw createLogicError(fmt::format("Required scenario {0:d} does not exist", u));
+            }
+            if(not selected[u])
+            {
+                select(u);
+            }
+        }
+
+        // Greedily select the scenario that minimizes the distance from the unselected scenarios to the selected ones
+        // (the probabilities are equal, so they do not change which scenario is best)
+        while(num_chosen < num_selected)
+        {
+            unsigned int best = num_scenarios;
+            float best_cost   = std::numeric_limits<float>::infinity();
+            for(unsigned int u = 0; u < num_scenarios; ++u)
+            {
+                if(selected[u])
+                {
+                    continue;
+                }
+
+                float cost = 0.0f;
+                for(unsigned int i = 0; i < num_scenarios; ++i)
+                {
+                    if(i != u and not selected[i])
+                    {
+                        cost += std::min(closest[i], distances[i * num_scenarios + u]);
+                    }
+                }
+                if(cost < best_cost)
+                {
+                    best      = u;
+                    best_cost = cost;
+                }
+            }
+            select(best);
+        }
+
+        ReducedScenarios rv;
+        rv.indices.reserve(num_selected);
+        for(unsigned int u = 0; u < num_scenarios; ++u)
+        {
+            if(selected[u])
+            {
+                rv.indices.push_back(u);
+            }
+        }
+
+        // Reassign the probability of each unselected scenario to its closest selected scenario
+        rv.weights.assign(num_selected, 0.0f);
+        const float probability = 1.0f / static_cast<float>(num_scenarios);
+        for(unsigned int i = 0; i < num_scenarios; ++i)
+        {
+            unsigned int closest_index = 0;
+            for(unsigned int k = 0; k < num_selected; ++k)
+            {
+                if(rv.indices[k] == i)
+                {
+                    closest_index = k;
+                    break;
+                }
+                if(distances[i * num_scenarios + rv.indices[k]] <
+                   distances[i * num_scenarios + rv.indices[closest_index]])
+                {
+                    closest_index = k;
+                }
+            }
+            rv.weights[closest_index] += probability;
+        }
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
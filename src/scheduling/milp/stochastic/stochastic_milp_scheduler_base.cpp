@@ -22,11 +22,19 @@
  */
 #include "grstapse/scheduling/milp/stochastic/stochastic_milp_scheduler_base.hpp"
 
+// Global
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <optional>
+// External
+#include <omp.h>
 // Local
 #include "grstapse/common/milp/milp_solver_result.hpp"
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/common/utilities/metrics.hpp"
 #include "grstapse/common/utilities/timeout_failure.hpp"
 #include "grstapse/geometric_planning/environments/sampled_euclidean_graph_environment.hpp"
 #include "grstapse/geometric_planning/motion_planners/masked_complete_sampled_euclidean_graph_motion_planner.hpp"
@@ -34,6 +42,8 @@
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/scheduling/milp/mutex_indicators.hpp"
 #include "grstapse/scheduling/milp/stochastic/heuristic_approximation/sequential_probability_ratio_test.hpp"
+#include "grstapse/scheduling/milp/stochastic/scenario_reduction.hpp"
+#include "grstapse/scheduling/milp/stochastic/sprt_rejected_failure.hpp"
 #include "grstapse/scheduling/milp/stochastic/stochastic_schedule.hpp"
 #include "grstapse/scheduling/schedule_base.hpp"
 #include "grstapse/scheduling/scheduler_result.hpp"
@@ -224,10 +234,6 @@ namespace grstapse
             return std::make_shared<SchedulerResult>(std::make_shared<TimeoutFailure>());
         }
 
-        const bool delta_percentage = m_problem_inputs->schedulerParameters()->get<bool>(constants::k_delta_percentage);
-        const float delta           = delta_percentage
-                                          ? 1.0f + m_problem_inputs->schedulerParameters()->get<float>(constants::k_delta)
-                                          : m_problem_inputs->schedulerParameters()->get<float>(constants::k_delta);
         const float indifference_tolerance =
             m_problem_inputs->schedulerParameters()->get<float>(constants::k_indifference_tolerance);
 
@@ -247,81 +253,149 @@ namespace grstapse
             m_motion_planner->setMask(mask);
         }
 
+        // Samples are computed lazily, so a robust makespan from the MILP may only need a few of them
         m_prior_sprt = std::vector<float>(num_g_scenarios, -1.0f);
-        while(not sprt.run(makespan, num_g_scenarios, sprtSample(num_g_scenarios)))
+        if(not sprt.run(makespan, num_g_scenarios, sprtSample(num_g_scenarios)))
         {
+            // With the mutex ordering fixed, each sample's makespan does not depend on the robust makespan, so compute
+            // all of them once and search the cached values for the smallest robust makespan the SPRT accepts
+            Logger::info("Increasing robust makespan.");
+            sampleBatch(0, num_g_scenarios);
             if(timer.get() > timeout)
             {
                 Logger::warn("Scheduler timed out");
                 return std::make_shared<SchedulerResult>(std::make_shared<TimeoutFailure>());
             }
-            Logger::info("Increasing robust makespan.");
-            if(delta_percentage)
-            {
-                makespan *= delta;
-            }
-            else
+
+            std::optional<float> robust_makespan = sprt.minimumAcceptedReference(makespan, m_prior_sprt);
+            if(not robust_makespan.has_value())
             {
-                makespan += delta;
+                // Increasing the robust makespan can never pass the SPRT (e.g. too few samples)
+                Logger::warn("SPRT does not accept any robust makespan");
+                return std::make_shared<SchedulerResult>(std::make_shared<SprtRejectedFailure>());
             }
+            makespan = *robust_makespan;
         }
 
         return std::make_shared<SchedulerResult>(
             std::make_shared<StochasticSchedule>(makespan, m_precedence_set_mutex_constraints));
     }
 
+    std::shared_ptr<const FailureReason> StochasticMilpSchedulerBase::createReducedMask(Timer& timer, float timeout)
+    {
+        const unsigned int num_reduced =
+            m_problem_inputs->schedulerParameters()->get<unsigned int>(constants::k_num_reduced_scenarios);
+        if(num_reduced == 0 || num_reduced >= m_num_scenarios)
+        {
+            return nullptr;
+        }
+
+        std::vector<unsigned int> graph_indices(m_num_scenarios);
+        std::iota(graph_indices.begin(), graph_indices.end(), 0u);
+        const std::vector<std::vector<float>> durations = scenarioDurationVectors(
+            *m_problem_inputs,
+            *std::dynamic_pointer_cast<SampledEuclideanGraphEnvironment>(m_motion_planner->environment()),
+            graph_indices);
+        if(timer.get() > timeout)
+        {
+            Logger::warn("Scheduler timed out");
+            return std::make_shared<TimeoutFailure>();
+        }
+
+        const ReducedScenarios reduced = reduceScenarios(durations, num_reduced);
+        Logger::info("Reduced {0:d} scenarios to {1:d}", m_num_scenarios, num_reduced);
+
+        std::vector<bool> mask(m_motion_planner->totalNumber(), false);
+        m_scenario_multiplicities.clear();
+        m_scenario_multiplicities.reserve(num_reduced);
+        for(unsigned int k = 0; k < num_reduced; ++k)
+        {
+            mask[reduced.indices[k]] = true;
+            m_scenario_multiplicities.push_back(reduced.weights[k] * m_num_scenarios);
+        }
+        m_motion_planner->setMask(mask);
+
+        m_num_scenarios = num_reduced;
+        m_y_indicators->resize(m_num_scenarios);
+        return nullptr;
+    }
+
     cppcoro::generator<float> StochasticMilpSchedulerBase::sprtSample(unsigned int num_g)
     {
+        const unsigned int batch_size = std::max(omp_get_max_threads(), 1);
         for(unsigned int i = 0; i < num_g; ++i)
         {
-            co_yield singleSample(i);
+            if(m_prior_sprt[i] <= -1.0f)
+            {
+                sampleBatch(i, std::min(i + batch_size, num_g));
+            }
+            co_yield m_prior_sprt[i];
         }
 
         co_return;
     }
 
-    float StochasticMilpSchedulerBase::singleSample(unsigned int index)
+    void StochasticMilpSchedulerBase::sampleBatch(unsigned int begin, unsigned int end)
     {
-        if(m_prior_sprt[index] > -1.0f)
+        // Exceptions cannot propagate out of an OpenMP region, so the first one is rethrown afterwards
+        std::exception_ptr exception = nullptr;
+        std::mutex exception_mutex;
+        const int num_samples = static_cast<int>(end - begin);
+        // Workers record their timings/counts into the same metrics as this thread
+        Metrics& metrics = Metrics::current();
+#pragma omp parallel for schedule(dynamic, 1) shared(exception, exception_mutex)
+        for(int i = 0; i < num_samples; ++i)
+        {
+            const unsigned int index = begin + i;
+            if(m_prior_sprt[index] > -1.0f)
+            {
+                continue;
+            }
+
+            try
+            {
+                Metrics::Activation activation(metrics);
+                m_prior_sprt[index] = singleSample(index);
+            }
+            catch(...)
+            {
+                std::lock_guard lock(exception_mutex);
+                if(exception == nullptr)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if(exception != nullptr)
         {
-            // Logger::info("Using cached sprt sample");
-            return m_prior_sprt[index];
+            std::rethrow_exception(exception);
         }
+    }
+
+    float StochasticMilpSchedulerBase::singleSample(unsigned int index)
+    {
         auto subproblem_mutex_indicator = std::make_shared<MutexIndicators>(m_problem_inputs, m_name_scheme, false);
         DeterministicMilpSubscheduler subscheduler(index, m_problem_inputs, subproblem_mutex_indicator, true);
-        if(std::shared_ptr<MilpSolverResult> result = subscheduler.createModel(m_problem_inputs->schedulerParameters());
-           result->failure())
+        if(std::shared_ptr<const FailureReason> failure_reason = subscheduler.setupData(); failure_reason)
         {
-            Logger::warn("Subscheduler {0:d} failed to create model", index);
+            Logger::warn("Subscheduler {0:d} failed to setup data", index);
             return std::numeric_limits<float>::infinity();
         }
 
         for(auto& [p, s]: m_precedence_set_mutex_constraints)
         {
-            if(subproblem_mutex_indicator->contains({p, s}))
-            {
-                fixVariable(subproblem_mutex_indicator->get({p, s}), 1.0);
-            }
-            else if(subproblem_mutex_indicator->contains({s, p}))
-            {
-                fixVariable(subproblem_mutex_indicator->get({s, p}), 0.0);
-            }
-            else
+            if(not subproblem_mutex_indicator->contains({p, s}) and not subproblem_mutex_indicator->contains({s, p}))
             {
                 throw createLogicError("Cannot find mutex constraint");
             }
         }
 
-        std::shared_ptr<const MilpSolverResult> result = subscheduler.resolve();
-
-        if(result->failure())
+        // With every mutex constraint ordered, the scenario is a longest path problem
+        const LongestPathResult result = subscheduler.longestPath(m_precedence_set_mutex_constraints);
+        if(result.makespan == std::numeric_limits<float>::infinity())
         {
-            Logger::warn("Subscheduler {0:d} failed to optimize model", index);
-            m_prior_sprt[index] = std::numeric_limits<float>::infinity();
-            return m_prior_sprt[index];
+            Logger::warn("Subscheduler {0:d} has a cyclic ordering", index);
         }
-
-        m_prior_sprt[index] = variableValue(subscheduler.makespanVariable());
-        return m_prior_sprt[index];
+        return result.makespan;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/mutex_set.hpp"
+
+// Global
+#include <algorithm>
+#include <bit>
+// Local
+#include "grstapse/scheduling/precedence_closure.hpp"
+
+namespace grstapse
+{
+    MutexSet::MutexSet()
+        : MutexSet(0, 0)
+    {}
+
+    MutexSet::MutexSet(unsigned int num_tasks, unsigned int num_robots)
+        : m_num_tasks(num_tasks)
+        , m_num_robots(num_robots)
+        , m_words_per_row((num_tasks + k_bits_per_word - 1) / k_bits_per_word)
+        , m_task_words(num_tasks * m_words_per_row, Word{0})
+        , m_robot_words(num_robots * m_words_per_row, Word{0})
+    {}
+
+    MutexSet::MutexSet(const Eigen::MatrixXf& allocation)
+        : MutexSet(allocation.rows(), allocation.cols())
+    {
+        for(unsigned int robot_nr = 0; robot_nr < m_num_robots; ++robot_nr)
+        {
+            for(unsigned int task_nr = 0; task_nr < m_num_tasks; ++task_nr)
+            {
+                if(allocation(task_nr, robot_nr))
+                {
+                    add(task_nr, robot_nr);
+                }
+            }
+        }
+    }
+
+    void MutexSet::add(unsigned int task, unsigned int robot)
+    {
+        Word* robot_row      = robotRow(robot);
+        const unsigned int t = task / k_bits_per_word;
+        const Word t_mask    = Word{1} << (task % k_bits_per_word);
+        if(robot_row[t] & t_mask)
+        {
+            return;
+        }
+
+        // Every task already allocated to the robot now shares it with task
+        Word* task_row = taskRow(task);
+        for(unsigned int w = 0; w < m_words_per_row; ++w)
+        {
+            task_row[w] |= robot_row[w];
+            for(Word word = robot_row[w]; word != 0; word &= word - 1)
+            {
+                taskRow(w * k_bits_per_word + std::countr_zero(word))[t] |= t_mask;
+            }
+        }
+        robot_row[t] |= t_mask;
+    }
+
+    void MutexSet::remove(unsigned int task, unsigned int robot)
+    {
+        Word* robot_row      = robotRow(robot);
+        const unsigned int t = task / k_bits_per_word;
+        const Word t_mask    = Word{1} << (task % k_bits_per_word);
+        if(!(robot_row[t] & t_mask))
+        {
+            return;
+        }
+        robot_row[t] &= ~t_mask;
+
+        // Other robots may still be shared with some of the robot's tasks, so rebuild the row from the robots that
+        // remain allocated to task
+        Word* task_row = taskRow(task);
+        std::vector<Word> previous(task_row, task_row + m_words_per_row);
+        std::fill(task_row, task_row + m_words_per_row, Word{0});
+        for(unsigned int robot_nr = 0; robot_nr < m_num_robots; ++robot_nr)
+        {
+            const Word* other_row = robotRow(robot_nr);
+            if(!(other_row[t] & t_mask))
+            {
+                continue;
+            }
+            for(unsigned int w = 0; w < m_words_per_row; ++w)
+            {
+                task_row[w] |= other_row[w];
+            }
+        }
+        task_row[t] &= ~t_mask;
+
+        for(unsigned int w = 0; w < m_words_per_row; ++w)
+        {
+            for(Word word = previous[w] & ~task_row[w]; word != 0; word &= word - 1)
+            {
+                taskRow(w * k_bits_per_word + std::countr_zero(word))[t] &= ~t_mask;
+            }
+        }
+    }
+
+    std::set<std::pair<unsigned int, unsigned int>> MutexSet::constraints() const
+    {
+        std::set<std::pair<unsigned int, unsigned int>> rv;
+        for(unsigned int i = 0; i < m_num_tasks; ++i)
+        {
+            std::span<const Word> row = taskWords(i);
+            // Only pairs with j > i (the matrix is symmetric)
+            for(unsigned int w = (i + 1) / k_bits_per_word; w < m_words_per_row; ++w)
+            {
+                Word word = row[w];
+                if(w == (i + 1) / k_bits_per_word)
+                {
+                    word &= ~Word{0} << ((i + 1) % k_bits_per_word);
+                }
+                for(; word != 0; word &= word - 1)
+                {
+                    rv.emplace_hint(rv.end(), i, w * k_bits_per_word + std::countr_zero(word));
+                }
+            }
+        }
+        return rv;
+    }
+
+    std::vector<std::pair<unsigned int, unsigned int>> MutexSet::unorderedConstraints(
+        const PrecedenceClosure& precedence_closure) const
+    {
+        std::vector<std::pair<unsigned int, unsigned int>> rv;
+        const unsigned int closure_tasks = precedence_closure.numberOfTasks();
+        for(unsigned int i = 0; i < m_num_tasks; ++i)
+        {
+            std::span<const Word> row = taskWords(i);
+            std::span<const Word> successors;
+            std::span<const Word> predecessors;
+            if(i < closure_tasks)
+            {
+                successors   = precedence_closure.successorWords(i);
+                predecessors = precedence_closure.predecessorWords(i);
+            }
+            for(unsigned int w = (i + 1) / k_bits_per_word; w < m_words_per_row; ++w)
+            {
+                Word word = row[w];
+                if(w == (i + 1) / k_bits_per_word)
+                {
+                    word &= ~Word{0} << ((i + 1) % k_bits_per_word);
+                }
+                if(w < successors.size())
+                {
+                    word &= ~(successors[w] | predecessors[w]);
+                }
+                for(; word != 0; word &= word - 1)
+                {
+                    rv.emplace_back(i, w * k_bits_per_word + std::countr_zero(word));
+                }
+            }
+        }
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/precedence_closure.hpp"
+
+// Global
+#include <algorithm>
+#include <bit>
+
+namespace grstapse
+{
+    PrecedenceClosure::PrecedenceClosure()
+        : m_num_tasks(0)
+        , m_words_per_task(0)
+    {}
+
+    PrecedenceClosure::PrecedenceClosure(
+        const std::set<std::pair<unsigned int, unsigned int>>& precedence_constraints,
+        unsigned int num_tasks)
+        : m_num_tasks(num_tasks)
+    {
+        for(const auto& [predecessor, successor]: precedence_constraints)
+        {
+            m_num_tasks = std::max({m_num_tasks, predecessor + 1, successor + 1});
+        }
+        m_words_per_task = (m_num_tasks + k_bits_per_word - 1) / k_bits_per_word;
+        m_words.assign(m_num_tasks * m_words_per_task, Word{0});
+
+        for(const auto& [predecessor, successor]: precedence_constraints)
+        {
+            m_words[predecessor * m_words_per_task + successor / k_bits_per_word] |= Word{1}
+                                                                                     << (successor % k_bits_per_word);
+        }
+
+        // Bit-parallel Warshall: once every path through tasks [0, k) is in the closure, any task that reaches k also
+        // reaches everything k reaches
+        for(unsigned int k = 0; k < m_num_tasks; ++k)
+        {
+            const Word* k_row = m_words.data() + k * m_words_per_task;
+            const Word k_mask = Word{1} << (k % k_bits_per_word);
+            for(unsigned int i = 0; i < m_num_tasks; ++i)
+            {
+                Word* i_row = m_words.data() + i * m_words_per_task;
+                if(i == k || !(i_row[k / k_bits_per_word] & k_mask))
+                {
+                    continue;
+                }
+                for(unsigned int w = 0; w < m_words_per_task; ++w)
+                {
+                    i_row[w] |= k_row[w];
+                }
+            }
+        }
+
+        m_predecessor_words.assign(m_words.size(), Word{0});
+        for(unsigned int i = 0; i < m_num_tasks; ++i)
+        {
+            std::span<const Word> row = successorWords(i);
+            for(unsigned int w = 0; w < m_words_per_task; ++w)
+            {
+                for(Word word = row[w]; word != 0; word &= word - 1)
+                {
+                    const unsigned int j = w * k_bits_per_word + std::countr_zero(word);
+                    m_predecessor_words[j * m_words_per_task + i / k_bits_per_word] |= Word{1} << (i % k_bits_per_word);
+                }
+            }
+        }
+    }
+
+    std::set<std::pair<unsigned int, unsigned int>> PrecedenceClosure::constraints() const
+    {
+        std::set<std::pair<unsigned int, unsigned int>> rv;
+        for(unsigned int i = 0; i < m_num_tasks; ++i)
+        {
+            std::span<const Word> row = successorWords(i);
+            for(unsigned int w = 0; w < m_words_per_task; ++w)
+            {
+                for(Word word = row[w]; word != 0; word &= word - 1)
+                {
+                    rv.emplace_hint(rv.end(), i, w * k_bits_per_word + std::countr_zero(word));
+                }
+            }
+        }
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -26,22 +26,42 @@
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/common/utilities/timer_runner.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
+#include "grstapse/scheduling/scheduler_result.hpp"
 
 namespace grstapse
 {
-    unsigned int SchedulerBase::s_num_failures = 0;
+    const MetricId SchedulerBase::s_num_failures_id    = Metrics::intern(constants::k_num_scheduling_failures);
+    const MetricId SchedulerBase::s_scheduling_time_id = Metrics::intern(constants::k_scheduling_time);
 
     SchedulerBase::SchedulerBase(const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs)
         : m_problem_inputs(problem_inputs)
+        , m_warm_start(nullptr)
+        , m_deadline(nullptr)
     {}
 
     std::shared_ptr<const SchedulerResult> SchedulerBase::solve()
     {
-        TimerRunner timer_runner(constants::k_scheduling_time);
-        return computeSchedule();
+        TimerRunner timer_runner(s_scheduling_time_id);
+        std::shared_ptr<const SchedulerResult> result = computeSchedule();
+        if(result->failed())
+        {
+            Metrics::current().increment(s_num_failures_id);
+        }
+        return result;
     }
+
+    void SchedulerBase::setWarmStart(const std::shared_ptr<const ScheduleBase>& schedule)
+    {
+        m_warm_start = schedule;
+    }
+
+    void SchedulerBase::setDeadline(const std::shared_ptr<const Deadline>& deadline)
+    {
+        m_deadline = deadline;
+    }
+
     unsigned int SchedulerBase::numFailures()
     {
-        return s_num_failures;
+        return static_cast<unsigned int>(Metrics::current().value(s_num_failures_id));
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -25,9 +25,29 @@
 // Local
 #include "grstapse/geometric_planning/configurations/configuration_base.hpp"
 #include "grstapse/robot.hpp"
+#include "grstapse/task.hpp"
 
 namespace grstapse
 {
+    float SchedulerMotionPlannerInterfaceBase::computeTaskDurationHeuristic(
+        const std::shared_ptr<const Task>& task,
+        const std::vector<std::shared_ptr<const Robot>>& coalition) const
+    {
+        if(coalition.empty())
+        {
+            return task->staticDuration();
+        }
+
+        // Same speed as Task::computeDuration, but the straight line instead of the motion plan
+        float speed = -1.0f;
+        for(const std::shared_ptr<const Robot>& robot: coalition)
+        {
+            speed = std::max(speed, robot->speed());
+        }
+        return task->initialConfiguration()->euclideanDistance(*task->terminalConfiguration()) / speed +
+               task->staticDuration();
+    }
+
     float SchedulerMotionPlannerInterfaceBase::computeInitialTransitionDurationHeuristic(
         const std::shared_ptr<const ConfigurationBase>& configuration,
         const std::shared_ptr<const Robot>& robot) const
@@ -0,0 +1,54 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/task_allocation/itags/allocation_key_memoization.hpp"
+
+namespace grstapse
+{
+    MemoizationKey AllocationKeyMemoization::operator()(
+        const std::shared_ptr<const IncrementalTaskAllocationNode>& node) const
+    {
+        const PackedAllocation& allocation = node->packedAllocation();
+        const std::uint64_t verification   = allocation.verificationKey();
+        MemoizationKey key                 = allocation.key();
+
+        std::lock_guard lock(m_mutex);
+        while(true)
+        {
+            auto [iter, inserted] = m_verification_keys.try_emplace(key, verification);
+            if(inserted || iter->second == verification)
+            {
+                return key;
+            }
+
+            // A different allocation already owns this key
+            ++m_num_collisions;
+            ++key;
+        }
+    }
+
+    bool AllocationKeyMemoization::equal(const std::shared_ptr<const IncrementalTaskAllocationNode>& lhs,
+                                         const std::shared_ptr<const IncrementalTaskAllocationNode>& rhs) const
+    {
+        return lhs->packedAllocation() == rhs->packedAllocation();
+    }
+}  // namespace grstapse
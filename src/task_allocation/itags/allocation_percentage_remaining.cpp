@@ -24,7 +24,6 @@
 
 // Local
 #include "grstapse/problem_inputs/itags_problem_inputs.hpp"
-#include "grstapse/task_allocation/itags/task_allocation_math.hpp"
 
 namespace grstapse
 {
@@ -36,11 +35,8 @@ namespace grstapse
 
     float AllocationPercentageRemaining::operator()(const std::shared_ptr<IncrementalTaskAllocationNode>& node) const
     {
-        const Eigen::MatrixXf& allocation = node->allocation();
-        const float traits_mismatch_error = traitsMismatchError(*m_problem_inputs->robotTraitsMatrixReduction(),
-                                                                allocation,
-                                                                m_problem_inputs->desiredTraitsMatrix(),
-                                                                m_problem_inputs->teamTraitsMatrix());
+        // Incrementally updated from the parent's error
+        const float traits_mismatch_error = node->traitsMismatchError(*m_problem_inputs);
 
         // ||max(E(A), 0)||_{1, 1} / ||Y||_{1,1}
         return traits_mismatch_error / m_desired_traits_sum;
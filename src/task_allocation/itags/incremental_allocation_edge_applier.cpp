@@ -23,6 +23,7 @@
 #include "grstapse/task_allocation/itags/incremental_allocation_edge_applier.hpp"
 
 // Local
+#include "grstapse/common/search/search_node_arena.hpp"
 #include "grstapse/problem_inputs/itags_problem_inputs.hpp"
 #include "grstapse/task_allocation/itags/task_allocation_math.hpp"
 
@@ -40,23 +41,17 @@ namespace grstapse
     bool IncrementalAllocationEdgeApplier::isApplicable(
         const std::shared_ptr<const IncrementalTaskAllocationNode>& base) const
     {
-        // If the assignment has already been added then ignore
-        std::shared_ptr<const IncrementalTaskAllocationNode> parent;
-        for(parent = base; parent != nullptr; parent = parent->parent())
-        {
-            if(const std::optional<Assignment>& last_assignment = parent->lastAssigment();
-               last_assignment.has_value() && last_assignment.value() == m_assignment)
-            {
-                return false;
-            }
-        }
-
-        return true;
+        // If the assignment has already been added (or removed for reverse) then ignore
+        return base->packedAllocation().get(m_assignment.task, m_assignment.robot) == m_use_reverse;
     }
 
     std::shared_ptr<IncrementalTaskAllocationNode> IncrementalAllocationEdgeApplier::apply(
         const std::shared_ptr<const IncrementalTaskAllocationNode>& base) const
     {
+        if(SearchNodeArena* arena = base->arena(); arena != nullptr)
+        {
+            return allocateSearchNode<IncrementalTaskAllocationNode>(*arena, m_assignment, base, m_use_reverse);
+        }
         return std::make_shared<IncrementalTaskAllocationNode>(m_assignment, base, m_use_reverse);
     }
 }  // namespace grstapse
\ No newline at end of file
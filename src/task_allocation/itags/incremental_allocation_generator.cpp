@@ -30,9 +30,20 @@
 namespace grstapse
 {
     IncrementalAllocationGenerator::IncrementalAllocationGenerator(
-        const std::shared_ptr<const ItagsProblemInputs>& problem_inputs)
+        const std::shared_ptr<const ItagsProblemInputs>& problem_inputs,
+        bool break_symmetry)
         : m_problem_inputs(problem_inputs)
+        , m_symmetry_classes(nullptr)
     {
+        if(break_symmetry)
+        {
+            auto symmetry_classes = std::make_shared<const RobotSymmetryClasses>(*problem_inputs);
+            if(symmetry_classes->hasSymmetry())
+            {
+                m_symmetry_classes = std::move(symmetry_classes);
+            }
+        }
+
         // Allocation matrix is M X N (number_of_tasks X number_of_robots)
         const unsigned int number_of_robots = m_problem_inputs->numberOfRobots();
         const unsigned int number_of_tasks  = m_problem_inputs->numberOfPlanTasks();
@@ -56,6 +67,12 @@ namespace grstapse
     bool IncrementalAllocationGenerator::isValidNode(
         const std::shared_ptr<const IncrementalTaskAllocationNode>& node) const
     {
-        return true;
+        if(m_symmetry_classes == nullptr || !node->lastAssigment().has_value())
+        {
+            return true;
+        }
+
+        // The parent is canonical, so only the column of the robot that changed can be out of order
+        return m_symmetry_classes->isCanonical(node->packedAllocation(), node->lastAssigment()->robot);
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -22,103 +22,186 @@
  */
 #include "grstapse/task_allocation/itags/incremental_task_allocation_node.hpp"
 
+// Global
+#include <algorithm>
+#include <limits>
 // Local
+#include "grstapse/common/search/search_node_arena.hpp"
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/common/utilities/hash_extension.hpp"
 #include "grstapse/common/utilities/json_extension.hpp"
 #include "grstapse/geometric_planning/configurations/configuration_base.hpp"
 #include "grstapse/geometric_planning/query_results/motion_planner_query_result_base.hpp"
+#include "grstapse/problem_inputs/itags_problem_inputs.hpp"
 #include "grstapse/problem_inputs/scheduler_problem_inputs.hpp"
 #include "grstapse/robot.hpp"
+#include "grstapse/scheduling/common_scheduler_motion_planner_interface.hpp"
+#include "grstapse/scheduling/makespan_lower_bound.hpp"
 #include "grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp"
 #include "grstapse/task.hpp"
 #include "grstapse/task_allocation/itags/normalized_schedule_quality.hpp"
+#include "grstapse/task_allocation/itags/robot_traits_matrix_reduction.hpp"
 #include "grstapse/task_allocation/itags/task_allocation_math.hpp"
 
 namespace grstapse
 {
-    unsigned int IncrementalTaskAllocationNode::s_next_id = 0;
+    std::atomic<unsigned int> IncrementalTaskAllocationNode::s_next_id = 0;
 
-    IncrementalTaskAllocationNode::IncrementalTaskAllocationNode(const MatrixDimensions& dimensions, bool use_reverse)
-        : Base_(s_next_id++, nullptr)
+    IncrementalTaskAllocationNode::IncrementalTaskAllocationNode(const MatrixDimensions& dimensions,
+                                                                 bool use_reverse,
+                                                                 SearchNodeArena* arena)
+        : Base_(nextId(arena), nullptr, arena)
         , m_last_assigment(std::nullopt)
-        , m_matrix_dimensions(dimensions)
+        , m_allocation(dimensions, use_reverse)
         , m_schedule(nullptr)
         , m_use_reverse(use_reverse)
+        , m_traits_mismatch_error(0.0f)
+        , m_num_unsatisfied_tasks(0)
+        , m_makespan_lower_bound(0.0f)
     {}
 
     IncrementalTaskAllocationNode::IncrementalTaskAllocationNode(
         const Assignment& assignment,
         const std::shared_ptr<const IncrementalTaskAllocationNode>& parent,
         bool use_reverse)
-        : Base_(s_next_id++, parent)
+        : Base_(nextId(parent->arena()), parent, parent->arena())
         , m_last_assigment(assignment)
-        , m_matrix_dimensions(std::nullopt)
+        , m_allocation(parent->m_allocation)
         , m_schedule(nullptr)
         , m_use_reverse(use_reverse)
+        , m_traits_mismatch_error(0.0f)
+        , m_num_unsatisfied_tasks(0)
+        , m_makespan_lower_bound(0.0f)
     {
         assert(parent);
+        // Forward search adds the robot to the task, reverse search removes it
+        m_allocation.set(assignment.task, assignment.robot, !m_use_reverse);
+    }
+
+    IncrementalTaskAllocationNode::IncrementalTaskAllocationNode(const PackedAllocation& allocation)
+        : Base_(s_next_id++, nullptr)
+        , m_last_assigment(std::nullopt)
+        , m_allocation(allocation)
+        , m_schedule(nullptr)
+        , m_use_reverse(false)
+        , m_traits_mismatch_error(0.0f)
+        , m_num_unsatisfied_tasks(0)
+        , m_makespan_lower_bound(0.0f)
+    {}
+
+    unsigned int IncrementalTaskAllocationNode::nextId(SearchNodeArena* arena)
+    {
+        return arena != nullptr ? arena->nextId() : s_next_id++;
     }
 
     const MatrixDimensions& IncrementalTaskAllocationNode::matrixDimensions() const
     {
-        if(m_matrix_dimensions.has_value())
-        {
-            return m_matrix_dimensions.value();
-        }
-        return m_parent->matrixDimensions();
+        return m_allocation.dimensions();
     }
 
     Eigen::MatrixXf IncrementalTaskAllocationNode::allocation() const
     {
-        if(!m_use_reverse)
-        {
-            const MatrixDimensions& dimensions = matrixDimensions();
+        return m_allocation.toMatrix();
+    }
 
-            // Allocation matrix is M X N (number_of_tasks X number_of_robots)
-            Eigen::MatrixXf matrix(dimensions.height, dimensions.width);  // (# rows, # columns)
-            matrix.setZero();
-            if(m_last_assigment == std::nullopt)
-            {
-                return matrix;
-            }
+    Eigen::MatrixXf IncrementalTaskAllocationNode::allocatedTraitsMatrix(
+        const ItagsProblemInputs& problem_inputs) const
+    {
+        return grstapse::allocatedTraitsMatrix(*problem_inputs.robotTraitsMatrixReduction(),
+                                               allocation(),
+                                               problem_inputs.teamTraitsMatrix());
+    }
 
-            matrix(m_last_assigment->task, m_last_assigment->robot) = 1.0f;
+    Eigen::RowVectorXf IncrementalTaskAllocationNode::allocatedTaskTraits(const ItagsProblemInputs& problem_inputs,
+                                                                          unsigned int task_nr) const
+    {
+        return problem_inputs.robotTraitsMatrixReduction()->reduceTask(m_allocation,
+                                                                       task_nr,
+                                                                       problem_inputs.teamTraitsMatrix());
+    }
 
-            std::shared_ptr<const IncrementalTaskAllocationNode> parent;
-            for(parent = m_parent; parent->m_last_assigment != std::nullopt; parent = parent->parent())
-            {
-                matrix(parent->m_last_assigment->task, parent->m_last_assigment->robot) = 1.0f;
-            }
-            return matrix;
-        }
-        else
-        {
+    float IncrementalTaskAllocationNode::traitsMismatchError(const ItagsProblemInputs& problem_inputs) const
+    {
+        computeTraits(problem_inputs);
+        return m_traits_mismatch_error;
+    }
+
+    void IncrementalTaskAllocationNode::computeTraits(const ItagsProblemInputs& problem_inputs) const
+    {
+        std::call_once(
+            m_traits_flag,
+            [this, &problem_inputs]()
             {
-                const MatrixDimensions& dimensions = matrixDimensions();
+                const Eigen::MatrixXf& desired_traits_matrix = problem_inputs.desiredTraitsMatrix();
 
-                // Allocation matrix is M X N (number_of_tasks X number_of_robots)
-                Eigen::MatrixXf matrix = Eigen::MatrixXf::Ones(dimensions.height, dimensions.width);
-                if(m_last_assigment == std::nullopt)
+                if(m_parent != nullptr && m_last_assigment.has_value())
                 {
-                    return matrix;
+                    // Only the error of the task from the last assignment differs from the parent. Both errors of
+                    // that task are computed exactly from the allocations
+                    const unsigned int task_nr = m_last_assigment->task;
+                    const float parent_error   = m_parent->traitsMismatchError(problem_inputs);
+                    const float old_task_error = taskTraitsMismatchError(
+                        m_parent->allocatedTaskTraits(problem_inputs, task_nr), desired_traits_matrix, task_nr);
+                    const float new_task_error = taskTraitsMismatchError(
+                        allocatedTaskTraits(problem_inputs, task_nr), desired_traits_matrix, task_nr);
+
+                    m_num_unsatisfied_tasks = m_parent->m_num_unsatisfied_tasks - (old_task_error > 0.0f) +
+                                              (new_task_error > 0.0f);
+                    // Rounding along a branch must not make a satisfied allocation look unsatisfied (or vice versa)
+                    m_traits_mismatch_error =
+                        m_num_unsatisfied_tasks == 0
+                            ? 0.0f
+                            : std::max(parent_error - old_task_error + new_task_error,
+                                       std::numeric_limits<float>::min());
+                    return;
                 }
 
-                matrix(m_last_assigment->task, m_last_assigment->robot) = 0.0f;
+                const Eigen::MatrixXf task_errors =
+                    (desired_traits_matrix - allocatedTraitsMatrix(problem_inputs)).cwiseMax(0.0f).rowwise().sum();
+                m_num_unsatisfied_tasks = (task_errors.array() > 0.0f).count();
+                m_traits_mismatch_error = task_errors.sum();
+            });
+    }
 
-                std::shared_ptr<const IncrementalTaskAllocationNode> parent;
-                for(parent = m_parent; parent->m_last_assigment != std::nullopt; parent = parent->parent())
-                {
-                    matrix(parent->m_last_assigment->task, parent->m_last_assigment->robot) = 0.0f;
-                }
-                return matrix;
-            }
-        }
+    const MutexSet& IncrementalTaskAllocationNode::mutexSet() const
+    {
+        std::call_once(m_mutex_set_flag,
+                       [this]()
+                       {
+                           if(m_parent != nullptr && m_last_assigment.has_value())
+                           {
+                               // Only the pairs involving the task from the last assignment can differ
+                               m_mutex_set = m_parent->mutexSet();
+                               if(m_use_reverse)
+                               {
+                                   m_mutex_set.remove(m_last_assigment->task, m_last_assigment->robot);
+                               }
+                               else
+                               {
+                                   m_mutex_set.add(m_last_assigment->task, m_last_assigment->robot);
+                               }
+                               return;
+                           }
+                           m_mutex_set = MutexSet(allocation());
+                       });
+        return m_mutex_set;
+    }
+
+    float IncrementalTaskAllocationNode::makespanLowerBound(const ItagsProblemInputs& problem_inputs) const
+    {
+        std::call_once(m_makespan_lower_bound_flag,
+                       [this, &problem_inputs]()
+                       {
+                           m_makespan_lower_bound = computeMakespanLowerBound(problem_inputs,
+                                                                              allocation(),
+                                                                              CommonSchedulerMotionPlannerInterface());
+                       });
+        return m_makespan_lower_bound;
     }
 
     unsigned int IncrementalTaskAllocationNode::hash() const
     {
-        return std::hash<Eigen::MatrixXf>()(allocation());
+        return m_allocation.hash();
     }
 
     nlohmann::json IncrementalTaskAllocationNode::serializeToJson(
@@ -128,13 +211,15 @@ namespace grstapse
         {
             return m_schedule->serializeToJson(std::make_shared<SchedulerProblemInputs>(
                 std::dynamic_pointer_cast<const ItagsProblemInputs>(problem_inputs),
-                allocation()));
+                allocation(),
+                mutexSet()));
         }
 
         // No schedule already computed
         auto scheduler_problem_inputs = std::make_shared<SchedulerProblemInputs>(
             std::dynamic_pointer_cast<const ItagsProblemInputs>(problem_inputs),
-            allocation());
+            allocation(),
+            mutexSet());
         DeterministicMilpScheduler scheduler(scheduler_problem_inputs);
         std::shared_ptr<const SchedulerResult> result = scheduler.solve();
         if(result->success())
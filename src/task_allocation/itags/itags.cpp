@@ -22,6 +22,11 @@
  */
 #include "grstapse/task_allocation/itags/itags.hpp"
 
+// Global
+#include <vector>
+// Local
+#include "grstapse/geometric_planning/motion_planners/motion_planner_base.hpp"
+
 namespace grstapse
 {
     Itags::Itags(
@@ -72,8 +77,22 @@ namespace grstapse
         const unsigned int num_robots = m_problem_inputs->numberOfRobots();
         const unsigned int num_tasks  = m_problem_inputs->numberOfPlanTasks();
         // Allocation matrix is M X N (number_of_tasks X number_of_robots)
-        return std::make_shared<IncrementalTaskAllocationNode>(
+        return allocateSearchNode<IncrementalTaskAllocationNode>(
+            *m_arena,
             MatrixDimensions{.height = num_tasks, .width = num_robots},
-            m_use_reverse);
+            m_use_reverse,
+            m_arena.get());
+    }
+
+    SearchResults<IncrementalTaskAllocationNode, ItagsStatistics> Itags::searchFromNode(
+        const std::shared_ptr<IncrementalTaskAllocationNode>& root)
+    {
+        // The motion planners belong to the problem (and may outlive this search)
+        std::vector<std::unique_ptr<MotionPlannerBase::DeadlineGuard>> deadline_guards;
+        for(const std::shared_ptr<MotionPlannerBase>& motion_planner: m_problem_inputs->motionPlanners())
+        {
+            deadline_guards.push_back(std::make_unique<MotionPlannerBase::DeadlineGuard>(*motion_planner, m_deadline));
+        }
+        return Base_::searchFromNode(root);
     }
 }  // namespace grstapse
\ No newline at end of file
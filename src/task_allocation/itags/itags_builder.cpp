@@ -22,16 +22,25 @@
  */
 #include "grstapse/task_allocation/itags/itags_builder.hpp"
 
+// External
+#include <magic_enum/magic_enum.hpp>
+#include <nlohmann/json.hpp>
 // Local
 #include "grstapse/common/search/disjunctive_pruning_method.hpp"
+#include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/parameters/parameters_base.hpp"
 #include "grstapse/scheduling/milp/stochastic/benders/benders_parallel_stochastic_milp_scheduler.hpp"
 #include "grstapse/scheduling/milp/stochastic/benders/benders_stochastic_milp_scheduler.hpp"
 #include "grstapse/scheduling/milp/stochastic/heuristic_approximation/gnn_scenario_selector.hpp"
 #include "grstapse/scheduling/milp/stochastic/heuristic_approximation/heuristic_approximation_stochastic_scheduler.hpp"
+#include "grstapse/scheduling/milp/stochastic/heuristic_approximation/native_gnn_scenario_selector.hpp"
 #include "grstapse/scheduling/milp/stochastic/monolithic/monolithic_stochastic_milp_scheduler.hpp"
+#include "grstapse/task_allocation/itags/allocation_key_memoization.hpp"
 #include "grstapse/task_allocation/itags/itags.hpp"
 #include "grstapse/task_allocation/itags/itags_builder_options.hpp"
 #include "grstapse/task_allocation/itags/itags_previous_failure_pruning_method.hpp"
+#include "grstapse/task_allocation/itags/makespan_lower_bound_pruning.hpp"
+#include "grstapse/task_allocation/itags/schedule_cache.hpp"
 
 namespace grstapse
 {
@@ -68,6 +77,11 @@ namespace grstapse
                         std::make_shared<ItagsPreviousFailurePruningMethod>(problem_inputs);
                     break;
                 }
+                case ItagsBuilderOptions::PrepruningMethodOptions::e_makespan_lower_bound:
+                {
+                    prepruning = std::make_shared<MakespanLowerBoundPruning>(problem_inputs);
+                    break;
+                }
                 default:
                 {
                     throw createLogicError("Unknown prepruning method");
@@ -97,6 +111,11 @@ namespace grstapse
                                      std::make_shared<ItagsPreviousFailurePruningMethod>(problem_inputs));
                         break;
                     }
+                    case ItagsBuilderOptions::PrepruningMethodOptions::e_makespan_lower_bound:
+                    {
+                        tmp->add(std::make_shared<MakespanLowerBoundPruning>(problem_inputs));
+                        break;
+                    }
                     default:
                     {
                         throw createLogicError("Unknown prepruning method");
@@ -151,6 +170,13 @@ namespace grstapse
         // endregion
 
         // region scheduler
+        // The stochastic schedulers set their scenario mask on the problem's (shared) masked motion planner, so nodes
+        // that use them cannot be evaluated concurrently
+        if(m_builder_options.scheduler != ItagsBuilderOptions::SchedulerOptions::e_deterministic_milp &&
+           problem_inputs->itagsParameters()->get<unsigned int>(constants::k_threads) > 1)
+        {
+            throw createLogicError("Stochastic schedulers do not support evaluating nodes with multiple threads");
+        }
         std::function<std::shared_ptr<SchedulerBase>(const std::shared_ptr<const SchedulerProblemInputs>&)>
             create_scheduler_function;
         switch(m_builder_options.scheduler)
@@ -226,11 +252,44 @@ namespace grstapse
                 };
                 break;
             }
+            case ItagsBuilderOptions::SchedulerOptions::e_native_gnn_heuristic_approximation_stochastic_milp:
+            {
+                create_scheduler_function =
+                    [](const std::shared_ptr<const SchedulerProblemInputs>& scheduler_problem_inputs)
+                    -> std::shared_ptr<SchedulerBase>
+                {
+                    return std::make_shared<HeuristicApproximationStochasticScheduler>(
+                        scheduler_problem_inputs,
+                        [](const std::shared_ptr<const grstapse::SchedulerProblemInputs>& problem_inputs)
+                        {
+                            return std::make_shared<grstapse::NativeGnnScenarioSelector>(problem_inputs);
+                        });
+                };
+                break;
+            }
+        }
+        // endregion
+
+        // region schedule cache
+        std::shared_ptr<ScheduleCache> schedule_cache = nullptr;
+        if(m_builder_options.schedule_cache_size > 0)
+        {
+            // Cached makespans are only valid for the same problem and scheduler configuration
+            const nlohmann::json configuration = {
+                {"scheduler", std::string(magic_enum::enum_name(m_builder_options.scheduler))},
+                {"scheduler_parameters", problem_inputs->schedulerParameters()->json()},
+                {"num_tasks", problem_inputs->numberOfPlanTasks()},
+                {"num_robots", problem_inputs->numberOfRobots()},
+                {"problem", ScheduleCache::problemHash(*problem_inputs)}};
+            schedule_cache = std::make_shared<ScheduleCache>(m_builder_options.schedule_cache_size,
+                                                             configuration.dump(),
+                                                             m_builder_options.schedule_cache_filepath);
         }
         // endregion
 
         // region heuristic
         std::shared_ptr<HeuristicBase<IncrementalTaskAllocationNode>> heuristic;
+        std::shared_ptr<NormalizedScheduleQuality> nsq;
         switch(m_builder_options.heuristic)
         {
             case ItagsBuilderOptions::HeuristicOptions::e_tetaq:
@@ -238,13 +297,14 @@ namespace grstapse
                 if(previous_failure_pruning_method)
                 {
                     auto apr = std::make_shared<AllocationPercentageRemaining>(problem_inputs);
-                    auto nsq = std::make_shared<NormalizedScheduleQuality>(
+                    nsq      = std::make_shared<NormalizedScheduleQuality>(
                         problem_inputs,
                         create_scheduler_function,
                         [previous_failure_pruning_method](const std::shared_ptr<const SchedulerResult>& result)
                         {
                             previous_failure_pruning_method->addFailureReason(result->failureReason());
                         });
+                    nsq->setScheduleCache(schedule_cache);
                     heuristic = std::make_shared<TimeExtendedTaskAllocationQuality>(problem_inputs,
                                                                                     m_builder_options.alpha,
                                                                                     apr,
@@ -252,8 +312,9 @@ namespace grstapse
                 }
                 else
                 {
-                    auto apr  = std::make_shared<AllocationPercentageRemaining>(problem_inputs);
-                    auto nsq  = std::make_shared<NormalizedScheduleQuality>(problem_inputs, create_scheduler_function);
+                    auto apr = std::make_shared<AllocationPercentageRemaining>(problem_inputs);
+                    nsq      = std::make_shared<NormalizedScheduleQuality>(problem_inputs, create_scheduler_function);
+                    nsq->setScheduleCache(schedule_cache);
                     heuristic = std::make_shared<TimeExtendedTaskAllocationQuality>(problem_inputs,
                                                                                     m_builder_options.alpha,
                                                                                     apr,
@@ -265,7 +326,7 @@ namespace grstapse
             {
                 if(previous_failure_pruning_method)
                 {
-                    heuristic = std::make_shared<NormalizedScheduleQuality>(
+                    nsq = std::make_shared<NormalizedScheduleQuality>(
                         problem_inputs,
                         create_scheduler_function,
                         [previous_failure_pruning_method](const std::shared_ptr<const SchedulerResult>& result)
@@ -275,8 +336,10 @@ namespace grstapse
                 }
                 else
                 {
-                    heuristic = std::make_shared<NormalizedScheduleQuality>(problem_inputs, create_scheduler_function);
+                    nsq = std::make_shared<NormalizedScheduleQuality>(problem_inputs, create_scheduler_function);
                 }
+                nsq->setScheduleCache(schedule_cache);
+                heuristic = nsq;
                 break;
             }
             case ItagsBuilderOptions::HeuristicOptions::e_apr:
@@ -289,6 +352,12 @@ namespace grstapse
                 throw createLogicError("Unknown heuristic");
             }
         }
+        if(nsq)
+        {
+            // Only skip scheduling by the makespan lower bound when the matching prepruning method was requested
+            nsq->setMakespanLowerBoundFilter(m_builder_options.prepruning.contains(
+                ItagsBuilderOptions::PrepruningMethodOptions::e_makespan_lower_bound));
+        }
         // endregion
 
         // region successor generator
@@ -300,6 +369,11 @@ namespace grstapse
                 successor_generator = std::make_shared<IncrementalAllocationGenerator>(problem_inputs);
                 break;
             }
+            case ItagsBuilderOptions::SuccessorGeneratorOptions::e_symmetric_increment:
+            {
+                successor_generator = std::make_shared<IncrementalAllocationGenerator>(problem_inputs, true);
+                break;
+            }
             default:
             {
                 throw createLogicError("Unknown successor generator");
@@ -337,6 +411,11 @@ namespace grstapse
                 memoization = std::make_shared<HashMemoization<IncrementalTaskAllocationNode>>();
                 break;
             }
+            case ItagsBuilderOptions::MemoizationOptions::e_allocation_key:
+            {
+                memoization = std::make_shared<AllocationKeyMemoization>();
+                break;
+            }
             default:
             {
                 throw createLogicError("Unknown memoization");
@@ -344,13 +423,21 @@ namespace grstapse
         }
         // endregion
 
-        return std::make_shared<Itags>(problem_inputs,
-                                       heuristic,
-                                       successor_generator,
-                                       goal_check,
-                                       memoization,
-                                       prepruning,
-                                       postpruning,
-                                       m_builder_options.use_reverse);
+        auto itags = std::make_shared<Itags>(problem_inputs,
+                                             heuristic,
+                                             successor_generator,
+                                             goal_check,
+                                             memoization,
+                                             prepruning,
+                                             postpruning,
+                                             m_builder_options.use_reverse);
+
+        // Let the scheduler stop in-flight work once the search times out (the motion planners follow the deadline
+        // while the search runs)
+        if(nsq)
+        {
+            nsq->setDeadline(itags->deadline());
+        }
+        return itags;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -60,6 +60,7 @@ namespace grstapse
         addMemoizationArguments(*config_app);
         addPrepruningArguments(*config_app);
         addPostpruningArguments(*config_app);
+        addScheduleCacheArguments(*config_app);
 
         try
         {
@@ -148,7 +149,10 @@ namespace grstapse
              "Successor Generator",
              "The algorithm to use to generate the successors of node",
              {{ItagsBuilderOptions::SuccessorGeneratorOptions::e_increment,
-               "Adds a single robot to a single task (all possible combinations)"}}});
+               "Adds a single robot to a single task (all possible combinations)"},
+              {ItagsBuilderOptions::SuccessorGeneratorOptions::e_symmetric_increment,
+               "Adds a single robot to a single task, skipping allocations that only permute interchangeable robots "
+               "(same species, traits, and initial configuration)"}}});
     }
 
     void ItagsCommandLineParser::addMemoizationArguments(CLI::App& app)
@@ -159,7 +163,9 @@ namespace grstapse
              "Memoization",
              "The algorithm to use to check if a node is the same as one that has already been visited",
              {{ItagsBuilderOptions::MemoizationOptions::e_null, "Each node is considered different"},
-              {ItagsBuilderOptions::MemoizationOptions::e_hash, "Hashes based on the allocation matrix"}}});
+              {ItagsBuilderOptions::MemoizationOptions::e_hash, "Hashes based on the allocation matrix"},
+              {ItagsBuilderOptions::MemoizationOptions::e_allocation_key,
+               "Incremental 64-bit key of the allocation with exact collision resolution"}}});
     }
 
     void ItagsCommandLineParser::addPrepruningArguments(CLI::App& app)
@@ -174,7 +180,9 @@ namespace grstapse
                "Prunes a node if it does not decrease the APR value from its parent"},
               {ItagsBuilderOptions::PrepruningMethodOptions::e_previous_failure_reason,
                "Prunes a node if it allocation a robot to a task that has been deemed impossible "
-               "previously by either scheduling or motion planning"}}});
+               "previously by either scheduling or motion planning"},
+              {ItagsBuilderOptions::PrepruningMethodOptions::e_makespan_lower_bound,
+               "Prunes a node if a critical path lower bound on its makespan exceeds the worst allowed makespan"}}});
     }
 
     void ItagsCommandLineParser::addPostpruningArguments(CLI::App& app)
@@ -186,4 +194,14 @@ namespace grstapse
              "The pruning methods to use after the heuristic is evaluated",
              {{ItagsBuilderOptions::PostpruningMethodOptions::e_null, "No pruning method is used"}}});
     }
+
+    void ItagsCommandLineParser::addScheduleCacheArguments(CLI::App& app)
+    {
+        app.add_option("--schedule-cache-size",
+                       m_builder_options.schedule_cache_size,
+                       "The maximum number of schedules to cache by allocation (0 disables the cache)");
+        app.add_option("--schedule-cache-file",
+                       m_builder_options.schedule_cache_filepath,
+                       "The filepath to persist the schedule cache to so that it can be reused by later runs");
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -26,6 +26,8 @@
 #include "grstapse/common/utilities/compound_failure_reason.hpp"
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/problem_inputs/itags_problem_inputs.hpp"
+#include "grstapse/scheduling/makespan_lower_bound_failure.hpp"
+#include "grstapse/scheduling/milp/stochastic/sprt_rejected_failure.hpp"
 #include "grstapse/species.hpp"
 #include "grstapse/task_allocation/robot_task_failure.hpp"
 #include "grstapse/task_allocation/robot_task_pair_failure.hpp"
@@ -66,17 +68,17 @@ namespace grstapse
 
         if(m_robot_task_pair_failures.contains(robot))
         {
-            Eigen::MatrixXf allocation = node->allocation();
-            auto begin_end             = m_robot_task_pair_failures.equal_range(robot);
+            const PackedAllocation& allocation = node->packedAllocation();
+            auto begin_end                     = m_robot_task_pair_failures.equal_range(robot);
             for(auto iter = begin_end.first; iter != begin_end.second; ++iter)
             {
                 const std::pair<unsigned int, unsigned int>& p = iter->second;
-                if(p.first == task && allocation(p.second, robot))
+                if(p.first == task && allocation.get(p.second, robot))
                 {
                     return true;
                 }
 
-                else if(p.second == task && allocation(p.first, robot))
+                else if(p.second == task && allocation.get(p.first, robot))
                 {
                     return true;
                 }
@@ -99,17 +101,17 @@ namespace grstapse
 
         if(m_species_task_pair_failures.contains(species))
         {
-            Eigen::MatrixXf allocation = node->allocation();
-            auto begin_end             = m_species_task_pair_failures.equal_range(species);
+            const PackedAllocation& allocation = node->packedAllocation();
+            auto begin_end                     = m_species_task_pair_failures.equal_range(species);
             for(auto iter = begin_end.first; iter != begin_end.second; ++iter)
             {
                 const std::pair<unsigned int, unsigned int>& p = iter->second;
-                if(p.first == task && allocation(p.second, robot))
+                if(p.first == task && allocation.get(p.second, robot))
                 {
                     return true;
                 }
 
-                else if(p.second == task && allocation(p.first, robot))
+                else if(p.second == task && allocation.get(p.first, robot))
                 {
                     return true;
                 }
@@ -163,6 +165,13 @@ namespace grstapse
             return;
         }
 
+        // Only says something about the whole allocation, so there is nothing to prune other nodes with
+        if(std::dynamic_pointer_cast<const MakespanLowerBoundFailure>(failure_reason) ||
+           std::dynamic_pointer_cast<const SprtRejectedFailure>(failure_reason))
+        {
+            return;
+        }
+
         throw createLogicError("Unknown failure reason");
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "grstapse/task_allocation/itags/normalized_schedule_quality.hpp"
 
 #include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/scheduling/makespan_lower_bound_failure.hpp"
 
 namespace grstapse
 {
@@ -38,6 +39,9 @@ namespace grstapse
               })
         , m_on_failure(on_failure)
         , m_on_success(on_success)
+        , m_schedule_cache(nullptr)
+        , m_deadline(nullptr)
+        , m_makespan_lower_bound_filter(false)
     {}
 
     NormalizedScheduleQuality::NormalizedScheduleQuality(
@@ -50,6 +54,9 @@ namespace grstapse
         , m_create_scheduler(create_scheduler)
         , m_on_failure(on_failure)
         , m_on_success(on_success)
+        , m_schedule_cache(nullptr)
+        , m_deadline(nullptr)
+        , m_makespan_lower_bound_filter(false)
     {}
 
     float NormalizedScheduleQuality::operator()(const std::shared_ptr<IncrementalTaskAllocationNode>& node) const
@@ -63,20 +70,100 @@ namespace grstapse
                (m_problem_inputs->scheduleWorstMakespan() - m_problem_inputs->scheduleBestMakespan());
     }
 
+    float NormalizedScheduleQuality::lowerBound(IncrementalTaskAllocationNode* node) const
+    {
+        const float makespan_lower_bound = node->makespanLowerBound(*m_problem_inputs);
+        if(m_makespan_lower_bound_filter && makespan_lower_bound > m_problem_inputs->scheduleWorstMakespan())
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+        return (makespan_lower_bound - m_problem_inputs->scheduleBestMakespan()) /
+               (m_problem_inputs->scheduleWorstMakespan() - m_problem_inputs->scheduleBestMakespan());
+    }
+
     float NormalizedScheduleQuality::computeMakespan(IncrementalTaskAllocationNode* node) const
     {
+        if(m_schedule_cache)
+        {
+            if(std::optional<ScheduleCache::Entry> entry = m_schedule_cache->find(node->packedAllocation()); entry)
+            {
+                if(entry->result != nullptr)
+                {
+                    return processResult(node, entry->result);
+                }
+                // Entries loaded from a file only have the makespan of a successful schedule, which is enough to rank
+                // a node that cannot be a goal. A possible goal needs a schedule from the configured scheduler, so it
+                // is rescheduled below (and the cache entry is replaced by the full result)
+                if(!couldBeGoal(node))
+                {
+                    node->setSchedule(nullptr);
+                    return entry->makespan;
+                }
+            }
+        }
+
+        // No schedule can be good enough, so skip the MILP (recorded as a failure like any other)
+        if(m_makespan_lower_bound_filter &&
+           node->makespanLowerBound(*m_problem_inputs) > m_problem_inputs->scheduleWorstMakespan())
+        {
+            return processResult(
+                node,
+                std::make_shared<const SchedulerResult>(std::make_shared<const MakespanLowerBoundFailure>()));
+        }
+
+        // The search is about to stop, so don't start a scheduler
+        if(m_deadline && m_deadline->expired())
+        {
+            node->setSchedule(nullptr);
+            return std::numeric_limits<float>::infinity();
+        }
+
         // Calculate the Makespan
-        auto scheduler_problem_inputs = std::make_shared<SchedulerProblemInputs>(m_problem_inputs, node->allocation());
+        auto scheduler_problem_inputs =
+            std::make_shared<SchedulerProblemInputs>(m_problem_inputs, node->allocation(), node->mutexSet());
         auto scheduler                = m_create_scheduler(scheduler_problem_inputs);
+        if(m_deadline)
+        {
+            scheduler->setDeadline(m_deadline);
+        }
+        // A child only adds a robot to a task, so the parent's mutex orderings are a good starting point
+        if(const std::shared_ptr<const IncrementalTaskAllocationNode>& parent = node->parent();
+           parent != nullptr && parent->schedule() != nullptr)
+        {
+            scheduler->setWarmStart(parent->schedule());
+        }
         std::shared_ptr<const SchedulerResult> result = scheduler->solve();
+        // A failure may only be due to the deadline cutting the scheduler short
+        if(m_schedule_cache && !(m_deadline && m_deadline->expired() && result->failed()))
+        {
+            m_schedule_cache->insert(node->packedAllocation(), result);
+        }
+        return processResult(node, result);
+    }
+
+    bool NormalizedScheduleQuality::couldBeGoal(IncrementalTaskAllocationNode* node) const
+    {
+        // The reverse search checks the schedule of every node
+        return m_problem_inputs->useReverse() || node->traitsMismatchError(*m_problem_inputs) == 0.0f;
+    }
+
+    float NormalizedScheduleQuality::processResult(IncrementalTaskAllocationNode* node,
+                                                   const std::shared_ptr<const SchedulerResult>& result) const
+    {
         if(result->failed())
         {
-            m_on_failure(result);
+            {
+                std::lock_guard lock(m_callback_mutex);
+                m_on_failure(result);
+            }
             node->setSchedule(nullptr);
             return std::numeric_limits<float>::infinity();
         }
 
-        m_on_success(result);
+        {
+            std::lock_guard lock(m_callback_mutex);
+            m_on_success(result);
+        }
         node->setSchedule(result->schedule());
         return node->schedule()->makespan();
     }
@@ -0,0 +1,133 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/task_allocation/itags/packed_allocation.hpp"
+
+// Global
+#include <algorithm>
+#include <bit>
+
+namespace grstapse
+{
+    PackedAllocation::PackedAllocation(const MatrixDimensions& dimensions, bool value)
+        : m_dimensions(dimensions)
+        , m_words_per_task((dimensions.width + k_bits_per_word - 1) / k_bits_per_word)
+        , m_words(dimensions.height * m_words_per_task, Word{0})
+        , m_key(0)
+        , m_verification_key(0)
+    {
+        if(value)
+        {
+            for(unsigned int task = 0; task < m_dimensions.height; ++task)
+            {
+                for(unsigned int robot = 0; robot < m_dimensions.width; ++robot)
+                {
+                    set(task, robot, true);
+                }
+            }
+        }
+    }
+
+    PackedAllocation::PackedAllocation(const Eigen::MatrixXf& allocation)
+        : PackedAllocation(MatrixDimensions{.height = static_cast<unsigned int>(allocation.rows()),
+                                            .width  = static_cast<unsigned int>(allocation.cols())})
+    {
+        for(unsigned int task = 0; task < m_dimensions.height; ++task)
+        {
+            for(unsigned int robot = 0; robot < m_dimensions.width; ++robot)
+            {
+                if(allocation(task, robot) != 0.0f)
+                {
+                    set(task, robot, true);
+                }
+            }
+        }
+    }
+
+    unsigned int PackedAllocation::numberOfRobots(unsigned int task) const
+    {
+        unsigned int rv = 0;
+        for(const Word word: taskWords(task))
+        {
+            rv += std::popcount(word);
+        }
+        return rv;
+    }
+
+    unsigned int PackedAllocation::numberOfAssignments() const
+    {
+        unsigned int rv = 0;
+        for(const Word word: m_words)
+        {
+            rv += std::popcount(word);
+        }
+        return rv;
+    }
+
+    bool PackedAllocation::isZero() const
+    {
+        return std::all_of(m_words.begin(),
+                           m_words.end(),
+                           [](const Word word)
+                           {
+                               return word == 0;
+                           });
+    }
+
+    std::strong_ordering PackedAllocation::compareRobots(unsigned int lhs, unsigned int rhs) const
+    {
+        for(unsigned int task = 0; task < m_dimensions.height; ++task)
+        {
+            const bool lhs_allocated = get(task, lhs);
+            if(lhs_allocated != get(task, rhs))
+            {
+                return lhs_allocated ? std::strong_ordering::greater : std::strong_ordering::less;
+            }
+        }
+        return std::strong_ordering::equal;
+    }
+
+    Eigen::MatrixXf PackedAllocation::toMatrix() const
+    {
+        // Allocation matrix is M X N (number_of_tasks X number_of_robots)
+        Eigen::MatrixXf matrix = Eigen::MatrixXf::Zero(m_dimensions.height, m_dimensions.width);
+        for(unsigned int task = 0; task < m_dimensions.height; ++task)
+        {
+            const std::span<const Word> words = taskWords(task);
+            for(unsigned int word_nr = 0; word_nr < m_words_per_task; ++word_nr)
+            {
+                // Only visit the set bits
+                for(Word word = words[word_nr]; word != 0; word &= word - 1)
+                {
+                    const unsigned int robot = word_nr * k_bits_per_word + std::countr_zero(word);
+                    matrix(task, robot)      = 1.0f;
+                }
+            }
+        }
+        return matrix;
+    }
+
+    bool PackedAllocation::operator==(const PackedAllocation& rhs) const
+    {
+        return m_key == rhs.m_key && m_dimensions == rhs.m_dimensions && m_words == rhs.m_words;
+    }
+}  // namespace grstapse
@@ -71,7 +71,8 @@ namespace grstapse
     float PercentOverSchedule::computeMakespan(IncrementalTaskAllocationNode* node) const
     {
         // Calculate the Makespan
-        auto scheduler_problem_inputs = std::make_shared<SchedulerProblemInputs>(m_problem_inputs, node->allocation());
+        auto scheduler_problem_inputs =
+            std::make_shared<SchedulerProblemInputs>(m_problem_inputs, node->allocation(), node->mutexSet());
         auto scheduler                = m_create_scheduler(scheduler_problem_inputs);
         std::shared_ptr<const SchedulerResult> result = scheduler->solve();
         if(result->failed())
@@ -0,0 +1,121 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/task_allocation/itags/robot_symmetry_classes.hpp"
+
+// Global
+#include <map>
+// Local
+#include "grstapse/geometric_planning/configurations/configuration_base.hpp"
+#include "grstapse/problem_inputs/itags_problem_inputs.hpp"
+#include "grstapse/robot.hpp"
+
+namespace grstapse
+{
+    RobotSymmetryClasses::RobotSymmetryClasses(const ItagsProblemInputs& problem_inputs)
+        : m_num_classes(0)
+    {
+        const unsigned int num_robots      = problem_inputs.numberOfRobots();
+        const Eigen::MatrixXf& team_traits = problem_inputs.teamTraitsMatrix();
+        std::vector<unsigned int> representatives;  // The first robot of each class
+        m_classes.reserve(num_robots);
+        for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+        {
+            const std::shared_ptr<const Robot>& robot = problem_inputs.robot(robot_nr);
+
+            unsigned int robot_class = representatives.size();
+            for(unsigned int class_nr = 0, end = representatives.size(); class_nr < end; ++class_nr)
+            {
+                const unsigned int representative_nr               = representatives[class_nr];
+                const std::shared_ptr<const Robot>& representative = problem_inputs.robot(representative_nr);
+                if(robot->species() == representative->species() &&
+                   team_traits.row(robot_nr) == team_traits.row(representative_nr) &&
+                   *robot->initialConfiguration() == *representative->initialConfiguration())
+                {
+                    robot_class = class_nr;
+                    break;
+                }
+            }
+            if(robot_class == representatives.size())
+            {
+                representatives.push_back(robot_nr);
+            }
+            m_classes.push_back(robot_class);
+        }
+        link();
+    }
+
+    RobotSymmetryClasses::RobotSymmetryClasses(const std::vector<unsigned int>& classes)
+        : m_classes(classes)
+        , m_num_classes(0)
+    {
+        link();
+    }
+
+    bool RobotSymmetryClasses::isCanonical(const PackedAllocation& allocation, unsigned int robot) const
+    {
+        if(m_previous[robot] != k_none && allocation.compareRobots(m_previous[robot], robot) < 0)
+        {
+            return false;
+        }
+        if(m_next[robot] != k_none && allocation.compareRobots(robot, m_next[robot]) < 0)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    bool RobotSymmetryClasses::isCanonical(const PackedAllocation& allocation) const
+    {
+        for(unsigned int robot = 0, end = m_classes.size(); robot < end; ++robot)
+        {
+            if(m_next[robot] != k_none && allocation.compareRobots(robot, m_next[robot]) < 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RobotSymmetryClasses::link()
+    {
+        m_previous.assign(m_classes.size(), k_none);
+        m_next.assign(m_classes.size(), k_none);
+
+        // class -> last robot seen from that class
+        std::map<unsigned int, unsigned int> last;
+        for(unsigned int robot = 0, end = m_classes.size(); robot < end; ++robot)
+        {
+            if(auto iter = last.find(m_classes[robot]); iter != last.end())
+            {
+                m_previous[robot]    = iter->second;
+                m_next[iter->second] = robot;
+                iter->second         = robot;
+            }
+            else
+            {
+                last.emplace(m_classes[robot], robot);
+            }
+        }
+        m_num_classes = last.size();
+    }
+}  // namespace grstapse
\ No newline at end of file
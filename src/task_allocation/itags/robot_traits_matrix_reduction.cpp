@@ -22,12 +22,16 @@
  */
 #include "grstapse/task_allocation/itags/robot_traits_matrix_reduction.hpp"
 
+// Global
+#include <algorithm>
 // External
 #include <fmt/format.h>
 #include <magic_enum/magic_enum.hpp>
 // Local
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/task_allocation/assignment.hpp"
+#include "grstapse/task_allocation/itags/packed_allocation.hpp"
 
 namespace grstapse
 {
@@ -217,31 +221,77 @@ namespace grstapse
 
             for(unsigned int trait_nr = 0; trait_nr < num_traits; ++trait_nr)
             {
-                switch(m_reduction_types[task_nr][trait_nr])
-                {
-                    case TraitsMatrixReductionTypes::e_summation:
-                        rv(task_nr, trait_nr) = allocated_traits_matrix.col(trait_nr).sum();
-                        break;
-                    case TraitsMatrixReductionTypes::e_product:
-                        rv(task_nr, trait_nr) = allocated_traits_matrix.col(trait_nr).prod();
-                        break;
-                    case TraitsMatrixReductionTypes::e_minimum:
-                        rv(task_nr, trait_nr) = allocated_traits_matrix.col(trait_nr).minCoeff();
-                        break;
-                    case TraitsMatrixReductionTypes::e_maximum:
-                        rv(task_nr, trait_nr) = allocated_traits_matrix.col(trait_nr).maxCoeff();
-                        break;
-                    case TraitsMatrixReductionTypes::e_custom:
-                        rv(task_nr, trait_nr) =
-                            m_custom.at(std::pair(task_nr, trait_nr))->reduce(allocated_traits_matrix.col(trait_nr));
-                        break;
-                }
+                rv(task_nr, trait_nr) = reduceElement(task_nr, trait_nr, allocated_traits_matrix.col(trait_nr));
             }
         }
 
         return rv;
     }
 
+    Eigen::RowVectorXf RobotTraitsMatrixReduction::reduceTask(const PackedAllocation& allocation,
+                                                              unsigned int task_nr,
+                                                              const Eigen::MatrixXf& robot_traits_matrix) const
+    {
+        const unsigned int num_traits = robot_traits_matrix.cols();
+        if(!m_matrix_multiply &&
+           (task_nr >= m_reduction_types.size() || num_traits != m_reduction_types[task_nr].size()))
+        {
+            throw createLogicError("Allocated traits matrix doesn't match with reduction types");
+        }
+
+        // The row is rebuilt from the robots allocated to the task instead of adding/subtracting the traits of a
+        // robot that changed, so that no floating point error accumulates along a branch of the search
+        Eigen::MatrixXf allocated_robot_traits(allocation.numberOfRobots(task_nr), num_traits);
+        unsigned int row_nr = 0;
+        for(unsigned int i = 0, i_end = robot_traits_matrix.rows(); i < i_end; ++i)
+        {
+            if(allocation.get(task_nr, i))
+            {
+                allocated_robot_traits.row(row_nr++) = robot_traits_matrix.row(i);
+            }
+        }
+
+        if(m_matrix_multiply)
+        {
+            return allocated_robot_traits.colwise().sum();
+        }
+
+        Eigen::RowVectorXf allocated_task_traits(num_traits);
+        for(unsigned int trait_nr = 0; trait_nr < num_traits; ++trait_nr)
+        {
+            allocated_task_traits(trait_nr) = reduceElement(task_nr, trait_nr, allocated_robot_traits.col(trait_nr));
+        }
+        return allocated_task_traits;
+    }
+
+    void RobotTraitsMatrixReduction::update(Eigen::MatrixXf& allocated_traits_matrix,
+                                            const PackedAllocation& allocation,
+                                            const Assignment& assignment,
+                                            const Eigen::MatrixXf& robot_traits_matrix) const
+    {
+        allocated_traits_matrix.row(assignment.task) = reduceTask(allocation, assignment.task, robot_traits_matrix);
+    }
+
+    float RobotTraitsMatrixReduction::reduceElement(unsigned int task_nr,
+                                                    unsigned int trait_nr,
+                                                    const Eigen::VectorXf& allocated_traits) const
+    {
+        switch(m_reduction_types[task_nr][trait_nr])
+        {
+            case TraitsMatrixReductionTypes::e_summation:
+                return allocated_traits.sum();
+            case TraitsMatrixReductionTypes::e_product:
+                return allocated_traits.prod();
+            case TraitsMatrixReductionTypes::e_minimum:
+                return allocated_traits.minCoeff();
+            case TraitsMatrixReductionTypes::e_maximum:
+                return allocated_traits.maxCoeff();
+            case TraitsMatrixReductionTypes::e_custom:
+                return m_custom.at(std::pair(task_nr, trait_nr))->reduce(allocated_traits);
+        }
+        throw createLogicError("Unknown reduction type");
+    }
+
     void from_json(const nlohmann::json& j, RobotTraitsMatrixReduction& r)
     {
         r.m_matrix_multiply = true;
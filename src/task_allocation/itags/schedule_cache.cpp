@@ -0,0 +1,263 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/task_allocation/itags/schedule_cache.hpp"
+
+// Global
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <vector>
+// External
+#include <boost/functional/hash.hpp>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/common/utilities/hash_extension.hpp"
+#include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/geometric_planning/configurations/configuration_base.hpp"
+#include "grstapse/problem_inputs/itags_problem_inputs.hpp"
+#include "grstapse/robot.hpp"
+#include "grstapse/scheduling/schedule_base.hpp"
+#include "grstapse/scheduling/scheduler_result.hpp"
+#include "grstapse/task.hpp"
+
+namespace grstapse
+{
+    ScheduleCache::ScheduleCache(std::size_t capacity,
+                                 const std::string& configuration,
+                                 const std::filesystem::path& filepath)
+        : m_capacity(capacity)
+        , m_configuration(configuration)
+        , m_filepath(filepath)
+        , m_num_hits(0)
+        , m_num_misses(0)
+    {
+        if(!m_filepath.empty())
+        {
+            load();
+        }
+    }
+
+    ScheduleCache::~ScheduleCache()
+    {
+        if(!m_filepath.empty())
+        {
+            try
+            {
+                save();
+            }
+            catch(const std::exception& e)
+            {
+                Logger::warn("Failed to save the schedule cache: {0:s}", e.what());
+            }
+        }
+    }
+
+    std::optional<ScheduleCache::Entry> ScheduleCache::find(const PackedAllocation& allocation)
+    {
+        std::lock_guard lock(m_mutex);
+        auto iter = m_index.find(allocation);
+        if(iter == m_index.end())
+        {
+            ++m_num_misses;
+            return std::nullopt;
+        }
+
+        // Move to the front as the most recently used
+        m_entries.splice(m_entries.begin(), m_entries, iter->second);
+        ++m_num_hits;
+        return iter->second->second;
+    }
+
+    void ScheduleCache::insert(const PackedAllocation& allocation,
+                               const std::shared_ptr<const SchedulerResult>& result)
+    {
+        const float makespan =
+            result->success() ? result->schedule()->makespan() : std::numeric_limits<float>::infinity();
+        std::lock_guard lock(m_mutex);
+        insertUnlocked(allocation, Entry{.makespan = makespan, .result = result});
+    }
+
+    void ScheduleCache::insertUnlocked(const PackedAllocation& allocation, Entry&& entry)
+    {
+        if(m_capacity == 0)
+        {
+            return;
+        }
+
+        if(auto iter = m_index.find(allocation); iter != m_index.end())
+        {
+            iter->second->second = std::move(entry);
+            m_entries.splice(m_entries.begin(), m_entries, iter->second);
+            return;
+        }
+
+        if(m_entries.size() >= m_capacity)
+        {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+        m_entries.emplace_front(allocation, std::move(entry));
+        m_index.emplace(allocation, m_entries.begin());
+    }
+
+    void ScheduleCache::load()
+    {
+        if(!std::filesystem::exists(m_filepath))
+        {
+            return;
+        }
+
+        // Parse everything before touching the cache so that a malformed file leaves it empty
+        std::vector<std::pair<PackedAllocation, float>> loaded;
+        try
+        {
+            std::ifstream fin(m_filepath);
+            nlohmann::json j;
+            fin >> j;
+            if(j.at("configuration").get<std::string>() != m_configuration)
+            {
+                Logger::warn("Ignoring schedule cache '{0:s}' as it was created for a different configuration",
+                             m_filepath.string());
+                return;
+            }
+
+            const MatrixDimensions dimensions{.height = j.at("dimensions").at(0).get<unsigned int>(),
+                                              .width  = j.at("dimensions").at(1).get<unsigned int>()};
+
+            const nlohmann::json& entries = j.at("entries");
+            loaded.reserve(entries.size());
+            for(const nlohmann::json& entry_j: entries)
+            {
+                PackedAllocation allocation(dimensions);
+                for(const nlohmann::json& assignment: entry_j.at("allocation"))
+                {
+                    const auto task  = assignment.at(0).get<unsigned int>();
+                    const auto robot = assignment.at(1).get<unsigned int>();
+                    if(task >= dimensions.height || robot >= dimensions.width)
+                    {
+                        throw createLogicError(
+                            fmt::format("Assignment ({0:d}, {1:d}) is outside of a {2:d}x{3:d} allocation",
+                                        task,
+                                        robot,
+                                        dimensions.height,
+                                        dimensions.width));
+                    }
+                    allocation.set(task, robot, true);
+                }
+                loaded.emplace_back(std::move(allocation), entry_j.at("makespan").get<float>());
+            }
+        }
+        catch(const std::exception& e)
+        {
+            Logger::warn("Ignoring schedule cache '{0:s}' as it could not be loaded: {1:s}",
+                         m_filepath.string(),
+                         e.what());
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        // Entries are saved most recently used first, so insert in reverse to keep that order
+        for(auto iter = loaded.rbegin(); iter != loaded.rend(); ++iter)
+        {
+            insertUnlocked(iter->first, Entry{.makespan = iter->second, .result = nullptr});
+        }
+    }
+
+    void ScheduleCache::save() const
+    {
+        nlohmann::json j;
+        j["configuration"] = m_configuration;
+
+        std::lock_guard lock(m_mutex);
+        nlohmann::json entries = nlohmann::json::array();
+        for(const auto& [allocation, entry]: m_entries)
+        {
+            // A failure has to go through the failure callbacks again with its reason, which is not persisted
+            if(std::isinf(entry.makespan))
+            {
+                continue;
+            }
+
+            const MatrixDimensions& dimensions = allocation.dimensions();
+            j["dimensions"]                    = {dimensions.height, dimensions.width};
+
+            nlohmann::json assignments = nlohmann::json::array();
+            for(unsigned int task = 0; task < dimensions.height; ++task)
+            {
+                for(unsigned int robot = 0; robot < dimensions.width; ++robot)
+                {
+                    if(allocation.get(task, robot))
+                    {
+                        assignments.push_back({task, robot});
+                    }
+                }
+            }
+
+            nlohmann::json entry_j;
+            entry_j["allocation"] = std::move(assignments);
+            entry_j["makespan"]   = entry.makespan;
+            entries.push_back(std::move(entry_j));
+        }
+        j["entries"] = std::move(entries);
+        if(!j.contains("dimensions"))
+        {
+            j["dimensions"] = {0, 0};
+        }
+
+        std::ofstream fout(m_filepath);
+        fout << j;
+    }
+
+    std::size_t ScheduleCache::size() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_entries.size();
+    }
+
+    std::size_t ScheduleCache::problemHash(const ItagsProblemInputs& problem_inputs)
+    {
+        std::size_t seed = 0;
+        for(const std::shared_ptr<const Task>& task: problem_inputs.planTasks())
+        {
+            boost::hash_combine(seed, task->staticDuration());
+            boost::hash_combine(seed, std::hash<Eigen::VectorXf>{}(task->desiredTraits()));
+            boost::hash_combine(seed, task->initialConfiguration()->hash());
+            boost::hash_combine(seed, task->terminalConfiguration()->hash());
+        }
+        boost::hash_combine(seed, std::hash<Eigen::MatrixXf>{}(problem_inputs.teamTraitsMatrix()));
+        for(const std::shared_ptr<const Robot>& robot: problem_inputs.robots())
+        {
+            boost::hash_combine(seed, robot->speed());
+            boost::hash_combine(seed, robot->boundingRadius());
+            boost::hash_combine(seed, robot->initialConfiguration()->hash());
+        }
+        for(const std::pair<unsigned int, unsigned int>& constraint: problem_inputs.precedenceConstraints())
+        {
+            boost::hash_combine(seed, constraint);
+        }
+        boost::hash_combine(seed, problem_inputs.motionPlannersHash());
+        return seed;
+    }
+}  // namespace grstapse
\ No newline at end of file
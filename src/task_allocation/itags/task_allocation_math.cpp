@@ -23,6 +23,8 @@
 #include "grstapse/task_allocation/itags/task_allocation_math.hpp"
 
 // Local
+#include "grstapse/scheduling/mutex_set.hpp"
+#include "grstapse/scheduling/precedence_closure.hpp"
 #include "grstapse/task.hpp"
 #include "grstapse/task_allocation/itags/robot_traits_matrix_reduction.hpp"
 
@@ -141,6 +143,14 @@ namespace grstapse
             .sum();
     }
 
+    float taskTraitsMismatchError(const Eigen::RowVectorXf& allocated_task_traits,
+                                  const Eigen::MatrixXf& desired_traits_matrix,
+                                  unsigned int task_nr)
+    {
+        // ||max(Y_i - (A * Q)_i, 0)||_1
+        return (desired_traits_matrix.row(task_nr) - allocated_task_traits).cwiseMax(0.0f).sum();
+    }
+
     float traitsLinearQualityCalculator(const RobotTraitsMatrixReduction& robot_traits_matrix_reduction,
                                         const Eigen::MatrixXf& allocation,
                                         const Eigen::MatrixXf& linear_coefficient_matrix,
@@ -155,67 +165,12 @@ namespace grstapse
 
     std::set<std::pair<unsigned int, unsigned int>> computeMutexConstraints(const Eigen::MatrixXf& allocation)
     {
-        if(allocation.isZero())
-        {
-            return std::set<std::pair<unsigned int, unsigned int>>();
-        }
-
-        std::set<std::pair<unsigned int, unsigned int>> mutex_constraints;
-        const unsigned int num_tasks  = allocation.rows();
-        const unsigned int num_robots = allocation.cols();
-        for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
-        {
-            std::vector<unsigned int> allocated_tasks;
-            for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
-            {
-                if(allocation(task_nr, robot_nr))
-                {
-                    allocated_tasks.push_back(task_nr);
-                }
-            }
-            if(!allocated_tasks.empty())
-            {
-                for(unsigned int task_i_index = 0, num_assigned_tasks = allocated_tasks.size();
-                    task_i_index < num_assigned_tasks;
-                    ++task_i_index)
-                {
-                    const unsigned int task_i = allocated_tasks[task_i_index];
-                    for(unsigned int task_j_index = task_i_index + 1; task_j_index < num_assigned_tasks; ++task_j_index)
-                    {
-                        const unsigned int task_j = allocated_tasks[task_j_index];
-                        mutex_constraints.insert({task_i, task_j});
-                    }
-                }
-            }
-        }
-        return mutex_constraints;
+        return MutexSet(allocation).constraints();
     }
 
     std::set<std::pair<unsigned int, unsigned int>> addPrecedenceTransitiveConstraints(
         std::set<std::pair<unsigned int, unsigned int>> ordering_constraints)
     {
-        unsigned int num_ordering_constraints = ordering_constraints.size();
-        while(true)
-        {
-            std::set<std::pair<unsigned int, unsigned int>> temp;
-            for(const std::pair<unsigned int, unsigned int>& constraint1: ordering_constraints)
-            {
-                temp.insert(constraint1);
-                for(const std::pair<unsigned int, unsigned int>& constraint2: ordering_constraints)
-                {
-                    if(constraint1.second == constraint2.first)
-                    {
-                        temp.insert(std::pair(constraint1.first, constraint2.second));
-                    }
-                }
-            }
-            ordering_constraints = std::move(temp);
-            if(num_ordering_constraints == ordering_constraints.size())
-            {
-                break;
-            }
-            num_ordering_constraints = ordering_constraints.size();
-        }
-        return ordering_constraints;
+        return PrecedenceClosure(ordering_constraints).constraints();
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -61,4 +61,10 @@ namespace grstapse
     {
         return m_alpha * m_apr->operator()(node) + (1.0f - m_alpha) * m_nsq->operator()(node);
     }
+
+    float TimeExtendedTaskAllocationQuality::optimisticEstimate(
+        const std::shared_ptr<IncrementalTaskAllocationNode>& node) const
+    {
+        return m_alpha * m_apr->operator()(node) + (1.0f - m_alpha) * m_nsq->lowerBound(node.get());
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -35,21 +35,25 @@ namespace grstapse
 
     bool TraitsImprovementPruning::operator()(const std::shared_ptr<const IncrementalTaskAllocationNode>& node) const
     {
-        // Allocation matrix is M X N (number_of_tasks X number_of_robots)
-        Eigen::MatrixXf potential_successor_matrix = node->allocation();
+        if(!node->lastAssigment().has_value())
+        {
+            return false;
+        }
+        const Assignment& assignment = node->lastAssigment().value();
 
-        Eigen::MatrixXf parent_matrix                                            = potential_successor_matrix;
-        parent_matrix(node->lastAssigment()->task, node->lastAssigment()->robot) = 0.0f;
+        // The allocation without the last assignment is the parent for a forward search (and the node itself for a
+        // reverse search)
+        const IncrementalTaskAllocationNode* without_last =
+            node->packedAllocation().get(assignment.task, assignment.robot) ? node->parent().get() : node.get();
 
-        const float potential_successor_error = traitsMismatchError(*m_problem_inputs->robotTraitsMatrixReduction(),
-                                                                    potential_successor_matrix,
-                                                                    m_problem_inputs->desiredTraitsMatrix(),
-                                                                    m_problem_inputs->teamTraitsMatrix());
-
-        const float parent_error = traitsMismatchError(*m_problem_inputs->robotTraitsMatrixReduction(),
-                                                       parent_matrix,
-                                                       m_problem_inputs->desiredTraitsMatrix(),
-                                                       m_problem_inputs->teamTraitsMatrix());
+        // Only the row of the task from the last assignment can differ, so compare the error for that task
+        const Eigen::MatrixXf& desired_traits_matrix = m_problem_inputs->desiredTraitsMatrix();
+        const float potential_successor_error        = taskTraitsMismatchError(
+            node->allocatedTaskTraits(*m_problem_inputs, assignment.task), desired_traits_matrix, assignment.task);
+        const float parent_error = taskTraitsMismatchError(
+            without_last->allocatedTaskTraits(*m_problem_inputs, assignment.task),
+            desired_traits_matrix,
+            assignment.task);
 
         return potential_successor_error >= parent_error;
     }
@@ -24,7 +24,6 @@
 
 // Local
 #include "grstapse/problem_inputs/itags_problem_inputs.hpp"
-#include "grstapse/task_allocation/itags/task_allocation_math.hpp"
 
 namespace grstapse
 {
@@ -34,16 +33,7 @@ namespace grstapse
 
     bool ZeroAprCheck::operator()(const std::shared_ptr<const IncrementalTaskAllocationNode>& node) const
     {
-        // A
-        const Eigen::MatrixXf& allocation = node->allocation();
-
-        // E
-        Eigen::MatrixXf traits_mismatch_matrix = traitsMismatchMatrix(*m_problem_inputs->robotTraitsMatrixReduction(),
-                                                                      allocation,
-                                                                      m_problem_inputs->desiredTraitsMatrix(),
-                                                                      m_problem_inputs->teamTraitsMatrix());
-
-        // Any positive value means that there are traits that are unsatisfied
-        return !(traits_mismatch_matrix.array() > 0).any();
+        // Any positive value in E = Y - A * Q means that there are traits that are unsatisfied
+        return node->traitsMismatchError(*m_problem_inputs) == 0.0f;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -41,7 +41,7 @@ namespace grstapse::mocks
        public:
         //! Constructor
         MockIncrementalTaskAllocationNode(const Eigen::MatrixXf& matrix)
-            : IncrementalTaskAllocationNode(MatrixDimensions{0, 0})
+            : IncrementalTaskAllocationNode(PackedAllocation(matrix))
             , m_matrix(matrix)
         {}
 
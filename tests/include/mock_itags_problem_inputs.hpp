@@ -59,8 +59,7 @@ namespace grstapse::mocks
                 m_desired_traits_matrix = grstapse::desiredTraitsMatrix(
                     planTasks() | ::ranges::to<std::vector<std::shared_ptr<const Task>>>());
             }
-            m_precedence_constraints  = precedence_constraints;
-            m_precedence_constraints  = addPrecedenceTransitiveConstraints(precedence_constraints);
+            setPrecedenceConstraints(precedence_constraints);
             m_schedule_best_makespan  = schedule_best_makespan;
             m_schedule_worst_makespan = schedule_worst_makespan;
         }
@@ -96,10 +96,13 @@ namespace grstapse::unittests
 
     /*!
      * Utility function to create the scheduler problem inputs
+     *
+     * \param warm_start Whether the scheduler parameters enable warm starting from a previous schedule
      */
     std::shared_ptr<SchedulerProblemInputs> createSchedulerProblemInputs(PlanOption plan_option,
                                                                          AllocationOption allocation_option,
-                                                                         bool homogeneous);
+                                                                         bool homogeneous,
+                                                                         bool warm_start = false);
     // endregion
 
 }  // namespace grstapse::unittests
\ No newline at end of file
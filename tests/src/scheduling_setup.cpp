@@ -309,7 +309,8 @@ namespace grstapse::unittests
     }
     std::shared_ptr<SchedulerProblemInputs> createSchedulerProblemInputs(PlanOption plan_option,
                                                                          AllocationOption allocation_option,
-                                                                         bool homogeneous)
+                                                                         bool homogeneous,
+                                                                         bool warm_start)
     {
         // region Grstaps Problem Inputs
         std::vector<std::shared_ptr<const Task>> tasks;
@@ -408,7 +409,8 @@ namespace grstapse::unittests
                            {constants::k_timeout, 1.0f},
                            {constants::k_milp_timeout, 1.0f},
                            {constants::k_threads, 0u},
-                           {constants::k_use_hierarchical_objective, true}});
+                           {constants::k_use_hierarchical_objective, true},
+                           {constants::k_warm_start, warm_start}});
         grstaps_problem_inputs->setScheduleParameters(schedule_parameters);
         // endregion
 
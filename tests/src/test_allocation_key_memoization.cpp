@@ -0,0 +1,82 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <memory>
+#include <set>
+#include <vector>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/task_allocation/itags/allocation_key_memoization.hpp>
+#include <grstapse/task_allocation/itags/incremental_task_allocation_node.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(AllocationKeyMemoization, SameAllocationDifferentOrder)
+    {
+        AllocationKeyMemoization memoization;
+
+        // Allocation matrix is M X N (number_of_tasks X number_of_robots)
+        auto root = std::make_shared<const IncrementalTaskAllocationNode>(MatrixDimensions{.height = 3, .width = 3});
+        auto a1   = std::make_shared<const IncrementalTaskAllocationNode>(Assignment{.task = 0, .robot = 0}, root);
+        auto a2   = std::make_shared<const IncrementalTaskAllocationNode>(Assignment{.task = 1, .robot = 2}, a1);
+        auto b1   = std::make_shared<const IncrementalTaskAllocationNode>(Assignment{.task = 1, .robot = 2}, root);
+        auto b2   = std::make_shared<const IncrementalTaskAllocationNode>(Assignment{.task = 0, .robot = 0}, b1);
+
+        ASSERT_EQ(memoization(a2), memoization(b2));
+        ASSERT_TRUE(memoization.equal(a2, b2));
+        ASSERT_NE(memoization(a1), memoization(b1));
+        ASSERT_FALSE(memoization.equal(a1, b1));
+        ASSERT_EQ(memoization.numberOfCollisions(), 0);
+    }
+
+    TEST(AllocationKeyMemoization, ParallelKeys)
+    {
+        AllocationKeyMemoization memoization;
+
+        // Every single assignment of a 8 X 8 allocation
+        auto root = std::make_shared<const IncrementalTaskAllocationNode>(MatrixDimensions{.height = 8, .width = 8});
+        std::vector<std::shared_ptr<const IncrementalTaskAllocationNode>> nodes;
+        for(unsigned int task = 0; task < 8; ++task)
+        {
+            for(unsigned int robot = 0; robot < 8; ++robot)
+            {
+                const Assignment assignment{.task = task, .robot = robot};
+                nodes.push_back(std::make_shared<const IncrementalTaskAllocationNode>(assignment, root));
+            }
+        }
+
+        std::vector<MemoizationKey> keys(nodes.size());
+#pragma omp parallel for
+        for(int i = 0; i < static_cast<int>(nodes.size()); ++i)
+        {
+            keys[i] = memoization(nodes[i]);
+        }
+
+        ASSERT_EQ(std::set<MemoizationKey>(keys.begin(), keys.end()).size(), nodes.size());
+        for(unsigned int i = 0; i < nodes.size(); ++i)
+        {
+            ASSERT_EQ(memoization(nodes[i]), keys[i]);
+        }
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
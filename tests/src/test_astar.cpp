@@ -22,6 +22,7 @@
  */
 // Global
 #include <memory>
+#include <stdexcept>
 // External
 #include <gtest/gtest.h>
 #include <robin_hood/robin_hood.hpp>
@@ -83,4 +84,105 @@ namespace grstapse::unittests
         assertGridCell(goal_node, goal);
         assertRoute(goal_node, {{0, 0}, {0, 1}, {0, 2}, {1, 2}});
     }
+
+    TEST(AStar, Map3x3Parallel)
+    {
+        std::shared_ptr<const ParametersBase> parameters =
+            ParametersFactory::instance().create(ParametersFactory::Type::e_search,
+                                                 {{constants::k_config_type, constants::k_best_first_search_parameters},
+                                                  {constants::k_has_timeout, false},
+                                                  {constants::k_timeout, 0.0f},
+                                                  {constants::k_timer_name, "astar_parallel"},
+                                                  {constants::k_threads, 4}});
+
+        robin_hood::unordered_set<GridCell> obstacles = {GridCell(1, 1), GridCell(2, 2)};
+
+        auto map     = std::make_shared<const GridMap>(3, 3, obstacles);
+        auto initial = std::make_shared<const GridCell>(0, 0);
+        auto goal    = std::make_shared<const GridCell>(1, 2);
+
+        // Children are inserted into the open set in generation order, so the route matches the serial search
+        GridSearch grid_search(parameters, map, initial, goal);
+        SearchResults<GridCellNode, SearchStatisticsCommon> solution = grid_search.search();
+        ASSERT_TRUE(solution.foundGoal());
+
+        std::shared_ptr<GridCellNode> goal_node = solution.goal();
+        assertGridCell(goal_node, goal);
+        assertRoute(goal_node, {{0, 0}, {0, 1}, {0, 2}, {1, 2}});
+    }
+
+    TEST(AStar, Map3x3Lazy)
+    {
+        std::shared_ptr<const ParametersBase> parameters =
+            ParametersFactory::instance().create(ParametersFactory::Type::e_search,
+                                                 {{constants::k_config_type, constants::k_best_first_search_parameters},
+                                                  {constants::k_has_timeout, false},
+                                                  {constants::k_timeout, 0.0f},
+                                                  {constants::k_timer_name, "astar_lazy"},
+                                                  {constants::k_lazy_evaluation, true}});
+
+        robin_hood::unordered_set<GridCell> obstacles = {GridCell(1, 1), GridCell(2, 2)};
+
+        auto map     = std::make_shared<const GridMap>(3, 3, obstacles);
+        auto initial = std::make_shared<const GridCell>(0, 0);
+        auto goal    = std::make_shared<const GridCell>(1, 2);
+
+        // The default optimistic estimate is exact, so deferring evaluation does not change the route
+        GridSearch grid_search(parameters, map, initial, goal);
+        SearchResults<GridCellNode, SearchStatisticsCommon> solution = grid_search.search();
+        ASSERT_TRUE(solution.foundGoal());
+
+        std::shared_ptr<GridCellNode> goal_node = solution.goal();
+        assertGridCell(goal_node, goal);
+        assertRoute(goal_node, {{0, 0}, {0, 1}, {0, 2}, {1, 2}});
+    }
+
+    TEST(AStar, Map3x3LazyThreads)
+    {
+        std::shared_ptr<const ParametersBase> parameters =
+            ParametersFactory::instance().create(ParametersFactory::Type::e_search,
+                                                 {{constants::k_config_type, constants::k_best_first_search_parameters},
+                                                  {constants::k_has_timeout, false},
+                                                  {constants::k_timeout, 0.0f},
+                                                  {constants::k_timer_name, "astar_lazy_threads"},
+                                                  {constants::k_threads, 4},
+                                                  {constants::k_lazy_evaluation, true}});
+
+        robin_hood::unordered_set<GridCell> obstacles = {GridCell(1, 1), GridCell(2, 2)};
+
+        auto map     = std::make_shared<const GridMap>(3, 3, obstacles);
+        auto initial = std::make_shared<const GridCell>(0, 0);
+        auto goal    = std::make_shared<const GridCell>(1, 2);
+
+        // Deferred evaluation is serial, so asking for threads as well is rejected
+        GridSearch grid_search(parameters, map, initial, goal);
+        ASSERT_THROW(grid_search.search(), std::logic_error);
+    }
+
+    TEST(AStar, Map3x3LowMemory)
+    {
+        std::shared_ptr<const ParametersBase> parameters =
+            ParametersFactory::instance().create(ParametersFactory::Type::e_search,
+                                                 {{constants::k_config_type, constants::k_best_first_search_parameters},
+                                                  {constants::k_has_timeout, false},
+                                                  {constants::k_timeout, 0.0f},
+                                                  {constants::k_timer_name, "astar_low_memory"},
+                                                  {constants::k_save_closed_nodes, true},
+                                                  {constants::k_low_memory, true}});
+
+        robin_hood::unordered_set<GridCell> obstacles = {GridCell(1, 1), GridCell(2, 2)};
+
+        auto map     = std::make_shared<const GridMap>(3, 3, obstacles);
+        auto initial = std::make_shared<const GridCell>(0, 0);
+        auto goal    = std::make_shared<const GridCell>(1, 2);
+
+        // The route can still be traced through the parents even though the closed nodes are not kept
+        GridSearch grid_search(parameters, map, initial, goal);
+        SearchResults<GridCellNode, SearchStatisticsCommon> solution = grid_search.search();
+        ASSERT_TRUE(solution.foundGoal());
+
+        std::shared_ptr<GridCellNode> goal_node = solution.goal();
+        assertGridCell(goal_node, goal);
+        assertRoute(goal_node, {{0, 0}, {0, 1}, {0, 2}, {1, 2}});
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/scheduling/milp/stochastic/benders/benders_cut_pool.hpp>
+#include <grstapse/scheduling/mutex_set.hpp>
+#include <grstapse/scheduling/precedence_closure.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(BendersCutPool, IsValid)
+    {
+        PrecedenceClosure closure({{0, 1}}, 4);
+        MutexSet mutex_set(4, 1);
+        mutex_set.add(1, 0);
+        mutex_set.add(2, 0);
+
+        // 0 -> 1 is a precedence constraint and 1 -> 2 is a mutex constraint
+        ASSERT_TRUE(BendersCutPool::isValid({0, 1, 2}, closure, mutex_set));
+        ASSERT_TRUE(BendersCutPool::isValid({2, 1}, closure, mutex_set));
+        // 2 -> 3 is neither
+        ASSERT_FALSE(BendersCutPool::isValid({1, 2, 3}, closure, mutex_set));
+        // 1 -> 0 contradicts the precedence constraint
+        ASSERT_FALSE(BendersCutPool::isValid({1, 0}, closure, mutex_set));
+        // Out of range of the problem
+        ASSERT_FALSE(BendersCutPool::isValid({0, 7}, closure, mutex_set));
+    }
+
+    TEST(BendersCutPool, AddAndEvict)
+    {
+        BendersCutPool pool(2);
+        pool.add(1, {0, 1});
+        pool.add(1, {0, 1});
+        pool.add(1, {});
+        ASSERT_EQ(pool.size(), 1);
+
+        pool.add(1, {1, 2});
+        pool.add(1, {0, 2});
+        ASSERT_EQ(pool.size(), 2);
+
+        PrecedenceClosure closure({{0, 1}, {1, 2}}, 3);
+        MutexSet mutex_set(3, 1);
+        // The oldest chain was evicted
+        std::vector<std::vector<unsigned int>> expected = {{1, 2}, {0, 2}};
+        ASSERT_EQ(pool.validChains(1, closure, mutex_set), expected);
+        ASSERT_TRUE(pool.validChains(0, closure, mutex_set).empty());
+
+        // An evicted chain can be added again
+        pool.add(1, {0, 1});
+        ASSERT_EQ(pool.size(), 2);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <chrono>
+#include <limits>
+#include <thread>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/common/utilities/deadline.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(Deadline, Never)
+    {
+        Deadline deadline;
+        ASSERT_FALSE(deadline.isSet());
+        ASSERT_FALSE(deadline.expired());
+        ASSERT_EQ(deadline.remaining(), std::numeric_limits<float>::infinity());
+
+        deadline.start(std::numeric_limits<float>::infinity());
+        ASSERT_FALSE(deadline.isSet());
+        ASSERT_FALSE(deadline.expired());
+    }
+
+    TEST(Deadline, Expire)
+    {
+        Deadline deadline;
+        deadline.start(0.05f);
+        ASSERT_TRUE(deadline.isSet());
+        ASSERT_FALSE(deadline.expired());
+        ASSERT_GT(deadline.remaining(), 0.0f);
+        ASSERT_LE(deadline.remaining(), 0.05f);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        ASSERT_TRUE(deadline.expired());
+        ASSERT_EQ(deadline.remaining(), 0.0f);
+
+        // Time already spent can exceed the timeout
+        deadline.start(-1.0f);
+        ASSERT_TRUE(deadline.expired());
+    }
+
+    TEST(Deadline, Cancel)
+    {
+        Deadline deadline;
+        std::thread canceller(
+            [&deadline]()
+            {
+                deadline.cancel();
+            });
+        canceller.join();
+        ASSERT_TRUE(deadline.cancelled());
+        ASSERT_TRUE(deadline.expired());
+        ASSERT_EQ(deadline.remaining(), 0.0f);
+
+        // Restarting clears the cancellation
+        deadline.start(10.0f);
+        ASSERT_FALSE(deadline.expired());
+        deadline.cancel();
+        ASSERT_TRUE(deadline.expired());
+        deadline.clear();
+        ASSERT_FALSE(deadline.expired());
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
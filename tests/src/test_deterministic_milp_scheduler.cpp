@@ -24,12 +24,14 @@
 
 // Global
 #    include <fstream>
+#    include <thread>
 // External
 #    include <fmt/format.h>
 #    include <gtest/gtest.h>
 // Project
 #    include <grstapse/common/utilities/json_extension.hpp>
 #    include <grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp>
+#    include <grstapse/scheduling/milp/mutex_indicators.hpp>
 #    include <grstapse/scheduling/scheduler_result.hpp>
 // Local
 #    include "mock_normalized_schedule_quality.hpp"
@@ -117,5 +119,96 @@ namespace grstapse::unittests
         MilpSolverBase::clearEnvironments();
     }
 
+    /*!
+     * Test that schedulers that are alive at the same time use separate environments and can solve concurrently
+     */
+    TEST(DeterministicMilpScheduler, ConcurrentSolves)
+    {
+        auto scheduler_problem_inputs =
+            createSchedulerProblemInputs(PlanOption::e_total_order, AllocationOption::e_identity, true);
+        DeterministicMilpScheduler scheduler_a(scheduler_problem_inputs);
+        DeterministicMilpScheduler scheduler_b(scheduler_problem_inputs);
+
+        std::shared_ptr<const SchedulerResult> result_a;
+        std::shared_ptr<const SchedulerResult> result_b;
+        std::thread thread_a(
+            [&]()
+            {
+                result_a = scheduler_a.solve();
+            });
+        std::thread thread_b(
+            [&]()
+            {
+                result_b = scheduler_b.solve();
+            });
+        thread_a.join();
+        thread_b.join();
+
+        ASSERT_TRUE(result_a->success());
+        ASSERT_TRUE(result_b->success());
+        ASSERT_NEAR(result_a->schedule()->makespan(), 29.0f, 1e-2);
+        ASSERT_NEAR(result_b->schedule()->makespan(), 29.0f, 1e-2);
+        ASSERT_GE(MilpSolverBase::numberOfEnvironments(), 2);
+    }
+
+    //! Exposes the mutex indicators of the deterministic MILP scheduler
+    class InspectableMilpScheduler : public DeterministicMilpScheduler
+    {
+       public:
+        using DeterministicMilpScheduler::DeterministicMilpScheduler;
+
+        [[nodiscard]] const std::shared_ptr<MutexIndicators>& mutexIndicators() const
+        {
+            return m_mutex_indicators;
+        }
+    };
+
+    /*!
+     * Test that the MIP start follows the mutex orderings of the previous schedule and doesn't change the makespan
+     */
+    TEST(DeterministicMilpScheduler, WarmStart)
+    {
+        // Robot 1 does tasks 1 and 3, so there is a mutex constraint to order
+        auto cold_problem_inputs =
+            createSchedulerProblemInputs(PlanOption::e_branch, AllocationOption::e_multi_task_robot, true);
+        DeterministicMilpScheduler cold_scheduler(cold_problem_inputs);
+        std::shared_ptr<const SchedulerResult> cold_result = cold_scheduler.solve();
+        ASSERT_TRUE(cold_result->success());
+        const std::shared_ptr<const ScheduleBase>& previous = cold_result->schedule();
+        ASSERT_FALSE(previous->precedenceSetMutexConstraints().empty());
+
+        auto warm_problem_inputs =
+            createSchedulerProblemInputs(PlanOption::e_branch, AllocationOption::e_multi_task_robot, true, true);
+        {
+            InspectableMilpScheduler scheduler(warm_problem_inputs);
+            scheduler.setWarmStart(previous);
+            [[maybe_unused]] auto model_result = scheduler.createModel(warm_problem_inputs->schedulerParameters());
+
+            MutexIndicators& indicators = *scheduler.mutexIndicators();
+            unsigned int num_started    = 0;
+            for(auto [predecessor, successor]: previous->precedenceSetMutexConstraints())
+            {
+                if(indicators.contains({predecessor, successor}))
+                {
+                    ASSERT_EQ(indicators.get({predecessor, successor}).get(GRB_DoubleAttr_Start), 1.0);
+                    ++num_started;
+                }
+                else if(indicators.contains({successor, predecessor}))
+                {
+                    ASSERT_EQ(indicators.get({successor, predecessor}).get(GRB_DoubleAttr_Start), 0.0);
+                    ++num_started;
+                }
+            }
+            ASSERT_GT(num_started, 0);
+        }
+
+        DeterministicMilpScheduler warm_scheduler(warm_problem_inputs);
+        warm_scheduler.setWarmStart(previous);
+        std::shared_ptr<const SchedulerResult> warm_result = warm_scheduler.solve();
+        ASSERT_TRUE(warm_result->success());
+        ASSERT_NEAR(warm_result->schedule()->makespan(), previous->makespan(), 1e-2);
+        MilpSolverBase::clearEnvironments();
+    }
+
 }  // namespace grstapse::unittests
 #endif
\ No newline at end of file
@@ -23,9 +23,11 @@
 
 // Global
 #include <fstream>
+#include <thread>
 // External
 #include <gtest/gtest.h>
 // Local
+#include <grstapse/common/utilities/deadline.hpp>
 #include <grstapse/common/utilities/json_extension.hpp>
 #include <grstapse/common/utilities/json_tree_factory.hpp>
 #include <grstapse/config.hpp>
@@ -64,6 +66,41 @@ namespace grstapse::unittests
         ASSERT_EQ(path.size(), 9);
     }
 
+    TEST(EuclideanGraphMotionPlanner, DeadlineGuard)
+    {
+        std::ifstream in(std::string(s_data_dir) +
+                         std::string("/geometric_planning/environments/euclidean_graph.json"));
+        nlohmann::json j;
+        in >> j;
+
+        auto parameters = ParametersFactory::instance().create(
+            ParametersFactory::Type::e_motion_planner,
+            nlohmann::json{
+                {constants::k_config_type, constants::k_euclidean_graph_motion_planner_parameters},
+                {constants::k_is_complete, true},
+                {constants::k_timeout, 1.0f}  // s
+            });
+        auto graph = j.get<std::shared_ptr<EuclideanGraphEnvironment>>();
+        EuclideanGraphMotionPlanner mp(parameters, graph);
+
+        auto initial_configuration = std::make_shared<const EuclideanGraphConfiguration>(0, 0.0f, 0.0f);
+        auto goal_configuration    = std::make_shared<const EuclideanGraphConfiguration>(18, 4.0f, 4.0f);
+        {
+            auto deadline = std::make_shared<Deadline>();
+            deadline->cancel();
+            MotionPlannerBase::DeadlineGuard guard(mp, deadline);
+
+            // Queries under an expired deadline are not memoized
+            [[maybe_unused]] auto result = mp.query(nullptr, initial_configuration, goal_configuration);
+            ASSERT_FALSE(mp.isMemoized(nullptr, initial_configuration, goal_configuration));
+        }
+
+        // The expired deadline does not outlive the guard
+        auto result = mp.query(nullptr, initial_configuration, goal_configuration);
+        ASSERT_EQ(result->status(), MotionPlannerQueryStatus::e_success);
+        ASSERT_TRUE(mp.isMemoized(nullptr, initial_configuration, goal_configuration));
+    }
+
     TEST(EuclideanGraphMotionPlanner, Load)
     {
         std::ifstream in(std::string(s_data_dir) +
@@ -83,4 +120,56 @@ namespace grstapse::unittests
         auto path = result->path();
         ASSERT_EQ(path.size(), 9);
     }
+
+    TEST(EuclideanGraphMotionPlanner, ConcurrentMemoization)
+    {
+        std::ifstream in(std::string(s_data_dir) +
+                         std::string("/geometric_planning/environments/euclidean_graph.json"));
+        nlohmann::json j;
+        in >> j;
+
+        auto parameters = ParametersFactory::instance().create(
+            ParametersFactory::Type::e_motion_planner,
+            nlohmann::json{
+                {constants::k_config_type, constants::k_euclidean_graph_motion_planner_parameters},
+                {constants::k_is_complete, true},
+                {constants::k_timeout, 1.0f}  // s
+            });
+        auto graph = j.get<std::shared_ptr<EuclideanGraphEnvironment>>();
+        EuclideanGraphMotionPlanner mp(parameters, graph);
+
+        auto initial_configuration = std::make_shared<const EuclideanGraphConfiguration>(0, 0.0f, 0.0f);
+        auto goal_configuration    = std::make_shared<const EuclideanGraphConfiguration>(18, 4.0f, 4.0f);
+        ASSERT_FALSE(mp.isMemoized(nullptr, initial_configuration, goal_configuration));
+
+        // Every thread uses its own copies of the configurations
+        std::vector<std::shared_ptr<const MotionPlannerQueryResultBase>> results(8);
+        std::vector<std::thread> threads;
+        for(unsigned int i = 0; i < results.size(); ++i)
+        {
+            threads.emplace_back(
+                [&mp, &results, i]()
+                {
+                    results[i] = mp.query(nullptr,
+                                          std::make_shared<const EuclideanGraphConfiguration>(0, 0.0f, 0.0f),
+                                          std::make_shared<const EuclideanGraphConfiguration>(18, 4.0f, 4.0f));
+                });
+        }
+        for(std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(mp.numMotionPlans(), 1);
+        ASSERT_TRUE(mp.isMemoized(nullptr, initial_configuration, goal_configuration));
+        for(const std::shared_ptr<const MotionPlannerQueryResultBase>& result: results)
+        {
+            ASSERT_EQ(result, results[0]);
+        }
+        ASSERT_EQ(results[0]->status(), MotionPlannerQueryStatus::e_success);
+
+        mp.clearCache();
+        ASSERT_EQ(mp.numMotionPlans(), 0);
+        ASSERT_FALSE(mp.isMemoized(nullptr, initial_configuration, goal_configuration));
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
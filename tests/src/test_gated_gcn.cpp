@@ -0,0 +1,107 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <tuple>
+// External
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+// Project
+#include <grstapse/scheduling/milp/stochastic/heuristic_approximation/gated_gcn.hpp>
+
+namespace grstapse::unittests
+{
+    namespace
+    {
+        //! A small model whose predictions were computed independently of the C++ implementation
+        nlohmann::json smallModel()
+        {
+            return R"({
+                "readout": "mean", "batch_norm": true, "residual": true, "use_edge_features": true,
+                "node_embedding": {"weight": [[0.5], [-1.0]], "bias": [0.1, 0.2]},
+                "edge_embedding": {"weight": [[0.3, 0.2], [-0.4, 0.1]], "bias": [0.0, 0.05]},
+                "layers": [{
+                    "node_self": {"weight": [[1.0, 0.5], [-0.5, 0.25]], "bias": [0.1, -0.1]},
+                    "node_neighbor": {"weight": [[0.2, -0.3], [0.4, 0.1]], "bias": [0.0, 0.2]},
+                    "edge_self": {"weight": [[0.6, 0.0], [0.1, -0.2]], "bias": [-0.1, 0.0]},
+                    "edge_source": {"weight": [[0.3, 0.3], [-0.2, 0.5]], "bias": [0.05, 0.0]},
+                    "edge_destination": {"weight": [[-0.1, 0.4], [0.2, 0.2]], "bias": [0.0, -0.05]},
+                    "node_batch_norm": {"weight": [1.5, 0.5], "bias": [0.1, -0.2], "running_mean": [0.2, -0.1],
+                                        "running_var": [2.0, 0.5], "eps": 1e-5},
+                    "edge_batch_norm": {"weight": [0.8, 1.2], "bias": [0.0, 0.3], "running_mean": [0.1, 0.0],
+                                        "running_var": [1.0, 4.0], "eps": 1e-5}}],
+                "readout_layers": [{"weight": [[0.7, -0.4, 1.0]], "bias": [0.1]},
+                                   {"weight": [[1.3]], "bias": [-0.2]}]
+            })"_json;
+        }
+
+        const std::vector<std::pair<unsigned int, unsigned int>> k_edges = {{0, 1}, {1, 2}, {2, 1}, {0, 2}};
+    }  // namespace
+
+    TEST(GatedGcn, Batch)
+    {
+        const GatedGcn model(smallModel());
+        ASSERT_EQ(model.hiddenDimension(), 2);
+        ASSERT_EQ(model.numberOfLayers(), 1);
+
+        GatedGcn::Matrix node_features(6, 1);
+        node_features << 1.0f, 2.0f, 0.5f, 3.0f, 0.0f, 1.0f;
+        GatedGcn::Matrix edge_features(8, 2);
+        // clang-format off
+        edge_features << 0.0f, 1.5f,
+                         0.0f, 2.0f,
+                         1.0f, 0.7f,
+                         1.0f, 3.0f,
+                         0.0f, 0.2f,
+                         0.0f, 4.0f,
+                         1.0f, 1.1f,
+                         1.0f, 0.3f;
+        // clang-format on
+        const std::vector<float> predictions = model.predict(3, k_edges, node_features, edge_features, 0.1f);
+        ASSERT_EQ(predictions.size(), 2);
+        EXPECT_NEAR(predictions[0], 0.8357738f, 1e-5f);
+        EXPECT_NEAR(predictions[1], 0.8683390f, 1e-5f);
+
+        // A graph scores the same on its own as it does in a batch
+        const std::vector<float> single =
+            model.predict(3, k_edges, node_features.bottomRows(3), edge_features.bottomRows(4), 0.1f);
+        ASSERT_EQ(single.size(), 1);
+        EXPECT_NEAR(single[0], predictions[1], 1e-6f);
+    }
+
+    TEST(GatedGcn, Invalid)
+    {
+        const GatedGcn model(smallModel());
+        const GatedGcn::Matrix node_features = GatedGcn::Matrix::Ones(3, 1);
+        const GatedGcn::Matrix edge_features = GatedGcn::Matrix::Ones(4, 2);
+        ASSERT_ANY_THROW(std::ignore = model.predict(2, k_edges, node_features, edge_features, 0.1f));
+        ASSERT_ANY_THROW(std::ignore = model.predict(3, k_edges, node_features, edge_features.topRows(3), 0.1f));
+        const std::vector<std::pair<unsigned int, unsigned int>> out_of_bounds = {{0, 3}, {0, 1}, {1, 2}, {2, 0}};
+        ASSERT_ANY_THROW(std::ignore = model.predict(3, out_of_bounds, node_features, edge_features, 0.1f));
+
+        // The readout needs the hidden dimension plus alpha as its input
+        nlohmann::json j = smallModel();
+        j["readout_layers"][0]["weight"][0].erase(2);
+        ASSERT_ANY_THROW(GatedGcn{j});
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,234 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+// External
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+// Project
+#include <grstapse/common/milp/milp_solver_base.hpp>
+#include <grstapse/common/utilities/constants.hpp>
+#include <grstapse/common/utilities/timer.hpp>
+#include <grstapse/config.hpp>
+#include <grstapse/geometric_planning/configurations/euclidean_graph_configuration.hpp>
+#include <grstapse/geometric_planning/environments/euclidean_graph_environment.hpp>
+#include <grstapse/geometric_planning/environments/sampled_euclidean_graph_environment.hpp>
+#include <grstapse/geometric_planning/motion_planners/masked_complete_sampled_euclidean_graph_motion_planner.hpp>
+#include <grstapse/problem_inputs/itags_problem_inputs.hpp>
+#include <grstapse/problem_inputs/scheduler_problem_inputs.hpp>
+#include <grstapse/robot.hpp>
+#include <grstapse/scheduling/milp/stochastic/heuristic_approximation/heuristic_scenario_selector.hpp>
+#include <grstapse/task.hpp>
+
+namespace grstapse::unittests
+{
+#ifndef NO_MILP
+    //! Exposes the labels of HeuristicScenarioSelector
+    class InspectableHeuristicScenarioSelector : public HeuristicScenarioSelector
+    {
+       public:
+        using HeuristicScenarioSelector::HeuristicScenarioSelector;
+        using HeuristicScenarioSelector::labels;
+    };
+
+    //! \returns The 10 task problem on the 10 sampled polypixel graphs
+    std::shared_ptr<SchedulerProblemInputs> createSelectorProblemInputs(std::optional<unsigned int> seed,
+                                                                        unsigned int num_reduced_scenarios)
+    {
+        std::ifstream in(std::string(s_data_dir) +
+                         std::string("/problem_inputs/itags/itags_heuristic_polypixel_400maps_10tasks_5robots.json"));
+        nlohmann::json j;
+        in >> j;
+        j[constants::k_motion_planners][0][constants::k_environment_parameters][constants::k_graph_filepath] =
+            "/geometric_planning/maps/polypixel_sampled_10.json";
+        j[constants::k_scheduler_parameters][constants::k_num_reduced_scenarios] = num_reduced_scenarios;
+        if(seed)
+        {
+            j[constants::k_scheduler_parameters][constants::k_seed] = *seed;
+        }
+        auto itags_problem_inputs = j.get<std::shared_ptr<ItagsProblemInputs>>();
+
+        Eigen::Matrix<float, 10, 5> allocation;
+        allocation << 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f;
+        return std::make_shared<SchedulerProblemInputs>(itags_problem_inputs, allocation);
+    }
+
+    //! \returns The motion planner (and sampled graphs) of \p problem_inputs
+    std::shared_ptr<MaskedCompleteSampledEuclideanGraphMotionPlanner> selectorMotionPlanner(
+        const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs)
+    {
+        return std::dynamic_pointer_cast<MaskedCompleteSampledEuclideanGraphMotionPlanner>(
+            problem_inputs->motionPlanner(0));
+    }
+
+    //! \returns The indices of the scenarios in \p mask
+    std::vector<unsigned int> selected(const std::vector<bool>& mask)
+    {
+        std::vector<unsigned int> rv;
+        for(unsigned int i = 0; i < mask.size(); ++i)
+        {
+            if(mask[i])
+            {
+                rv.push_back(i);
+            }
+        }
+        return rv;
+    }
+
+    TEST(HeuristicScenarioSelector, Labels)
+    {
+        {
+            auto problem_inputs = createSelectorProblemInputs(0, 0);
+            auto environment    = std::dynamic_pointer_cast<SampledEuclideanGraphEnvironment>(
+                selectorMotionPlanner(problem_inputs)->environment());
+            ASSERT_NE(environment, nullptr);
+            ASSERT_EQ(environment->numGraphs(), 10);
+
+            InspectableHeuristicScenarioSelector selector(problem_inputs);
+            const std::vector<float> labels = selector.labels(*environment, 10);
+            ASSERT_EQ(labels.size(), 10);
+
+            // Walk the tasks of each graph directly
+            for(unsigned int scenario = 0; scenario < 10; ++scenario)
+            {
+                const std::shared_ptr<EuclideanGraphEnvironment>& graph = environment->graphs()[scenario];
+                float expected                                          = 0.0f;
+                for(unsigned int task_nr = 0; task_nr < problem_inputs->numberOfPlanTasks(); ++task_nr)
+                {
+                    const std::shared_ptr<const Task>& task = problem_inputs->planTask(task_nr);
+                    expected += task->staticDuration();
+
+                    const auto initial =
+                        std::dynamic_pointer_cast<const EuclideanGraphConfiguration>(task->initialConfiguration());
+                    const auto terminal =
+                        std::dynamic_pointer_cast<const EuclideanGraphConfiguration>(task->terminalConfiguration());
+                    const unsigned int a = initial->id();
+                    const unsigned int b = terminal->id();
+                    float speed = std::numeric_limits<float>::max();
+                    for(const std::shared_ptr<const Robot>& robot: problem_inputs->coalition(task_nr))
+                    {
+                        speed = std::min(speed, robot->speed());
+                    }
+                    if(a != b && speed != std::numeric_limits<float>::max())
+                    {
+                        expected += graph->findEdge(a, b)->cost() / speed;
+                    }
+                }
+                ASSERT_NEAR(labels[scenario], expected, 1e-3f * expected);
+            }
+        }
+        MilpSolverBase::clearEnvironments();
+    }
+
+    TEST(HeuristicScenarioSelector, Seeded)
+    {
+        {
+            auto problem_inputs = createSelectorProblemInputs(42, 0);
+            auto motion_planner = selectorMotionPlanner(problem_inputs);
+            InspectableHeuristicScenarioSelector first(problem_inputs);
+            InspectableHeuristicScenarioSelector second(problem_inputs);
+
+            Timer timer;
+            timer.start();
+            const float timeout = std::numeric_limits<float>::infinity();
+            for(unsigned int i = 0; i < 5; ++i)
+            {
+                // 9 of the 10 scenarios are in the H set, so 3 of them are sampled
+                const std::optional<std::vector<bool>> first_mask =
+                    first.createMask(timer, motion_planner, 10, 3, 0.1f, timeout);
+                const std::optional<std::vector<bool>> second_mask =
+                    second.createMask(timer, motion_planner, 10, 3, 0.1f, timeout);
+                ASSERT_TRUE(first_mask.has_value());
+                ASSERT_TRUE(second_mask.has_value());
+                ASSERT_EQ(*first_mask, *second_mask);
+                ASSERT_EQ(selected(*first_mask).size(), 3);
+            }
+        }
+        MilpSolverBase::clearEnvironments();
+    }
+
+    TEST(HeuristicScenarioSelector, Reduction)
+    {
+        {
+            auto problem_inputs = createSelectorProblemInputs(0, 3);
+            auto motion_planner = selectorMotionPlanner(problem_inputs);
+            InspectableHeuristicScenarioSelector selector(problem_inputs);
+            const std::vector<float> labels = selector.labels(
+                *std::dynamic_pointer_cast<SampledEuclideanGraphEnvironment>(motion_planner->environment()),
+                10);
+
+            // The H set is every scenario except the one with the largest label, and its boundary is the second largest
+            std::vector<unsigned int> order(10);
+            std::iota(order.begin(), order.end(), 0u);
+            std::sort(order.begin(),
+                      order.end(),
+                      [&labels](unsigned int lhs, unsigned int rhs) -> bool
+                      {
+                          return std::pair(labels[lhs], lhs) < std::pair(labels[rhs], rhs);
+                      });
+            const unsigned int boundary = order[8];
+
+            Timer timer;
+            timer.start();
+            std::optional<std::vector<bool>> mask =
+                selector.createMask(timer, motion_planner, 10, 3, 0.1f, std::numeric_limits<float>::infinity());
+            ASSERT_TRUE(mask.has_value());
+            const std::vector<unsigned int> scenarios = selected(*mask);
+            ASSERT_EQ(scenarios.size(), 3);
+            ASSERT_TRUE((*mask)[boundary]);
+            ASSERT_FALSE((*mask)[order[9]]);
+        }
+        MilpSolverBase::clearEnvironments();
+    }
+
+    TEST(HeuristicScenarioSelector, EmptyHSet)
+    {
+        {
+            auto problem_inputs = createSelectorProblemInputs(0, 0);
+            HeuristicScenarioSelector selector(problem_inputs);
+            Timer timer;
+            timer.start();
+            // Gamma leaves less than half a scenario in the H set
+            ASSERT_ANY_THROW(std::ignore = selector.createMask(timer,
+                                                               selectorMotionPlanner(problem_inputs),
+                                                               10,
+                                                               3,
+                                                               0.99f,
+                                                               std::numeric_limits<float>::infinity()));
+        }
+        MilpSolverBase::clearEnvironments();
+    }
+#endif
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifdef GRSTAPSE_USE_HIGHS
+
+// External
+#    include <gtest/gtest.h>
+// Project
+#    include <grstapse/common/milp/milp_backend.hpp>
+
+namespace grstapse::unittests
+{
+    //! Lazily adds x + y <= 1 whenever the incumbent violates it
+    class AddCutCallback : public GRBCallback
+    {
+       public:
+        AddCutCallback(GRBVar x, GRBVar y)
+            : num_calls(0)
+            , m_x(x)
+            , m_y(y)
+        {}
+
+        unsigned int num_calls;
+
+       protected:
+        void callback() override
+        {
+            ++num_calls;
+            if(getSolution(m_x) + getSolution(m_y) > 1.5)
+            {
+                addLazy(m_x + m_y <= 1);
+            }
+        }
+
+       private:
+        GRBVar m_x;
+        GRBVar m_y;
+    };
+
+    TEST(HighsBackend, Milp)
+    {
+        GRBEnv env(true);
+        env.start();
+        GRBModel model(env);
+        GRBVar x = model.addVar(0.0, 10.0, 0.0, GRB_INTEGER, "x");
+        GRBVar y = model.addVar(0.0, 10.0, 0.0, GRB_INTEGER, "y");
+        model.addConstr(2 * x + 2 * y <= 7, "c");
+        model.set(GRB_IntAttr_ModelSense, GRB_MAXIMIZE);
+        model.setObjective(x + 2 * y);
+        model.optimize();
+
+        ASSERT_EQ(model.get(GRB_IntAttr_Status), GRB_OPTIMAL);
+        ASSERT_NEAR(x.get(GRB_DoubleAttr_X), 0.0, 1e-6);
+        ASSERT_NEAR(model.getVarByName("y").get(GRB_DoubleAttr_X), 3.0, 1e-6);
+
+        // Change the right hand side and resolve
+        model.getConstrByName("c").set(GRB_DoubleAttr_RHS, 3.0);
+        model.optimize();
+        ASSERT_EQ(model.get(GRB_IntAttr_Status), GRB_OPTIMAL);
+        ASSERT_NEAR(y.get(GRB_DoubleAttr_X), 1.0, 1e-6);
+    }
+
+    TEST(HighsBackend, Infeasible)
+    {
+        GRBEnv env;
+        GRBModel model(env);
+        GRBVar x = model.addVar(0.0, 1.0, 0.0, GRB_BINARY);
+        model.addConstr(x >= 2);
+        model.optimize();
+        ASSERT_EQ(model.get(GRB_IntAttr_Status), GRB_INFEASIBLE);
+        ASSERT_EQ(model.get(GRB_IntAttr_SolCount), 0);
+    }
+
+    TEST(HighsBackend, LazyConstraints)
+    {
+        GRBEnv env;
+        GRBModel model(env);
+        GRBVar x = model.addVar(0.0, 1.0, 0.0, GRB_BINARY);
+        GRBVar y = model.addVar(0.0, 1.0, 0.0, GRB_BINARY);
+        model.set(GRB_IntParam_LazyConstraints, 1);
+        model.set(GRB_IntAttr_ModelSense, GRB_MAXIMIZE);
+        model.setObjective(x + y);
+
+        AddCutCallback callback(x, y);
+        model.setCallback(&callback);
+        model.optimize();
+
+        ASSERT_EQ(model.get(GRB_IntAttr_Status), GRB_OPTIMAL);
+        ASSERT_NEAR(x.get(GRB_DoubleAttr_X) + y.get(GRB_DoubleAttr_X), 1.0, 1e-6);
+        // Once to cut off (1, 1) and once to accept the new incumbent
+        ASSERT_EQ(callback.num_calls, 2);
+    }
+
+    TEST(HighsBackend, MultipleObjectives)
+    {
+        GRBEnv env;
+        GRBModel model(env);
+        GRBVar makespan = model.addVar(-GRB_INFINITY, GRB_INFINITY, 0.0, GRB_CONTINUOUS);
+        GRBVar start    = model.addVar(-GRB_INFINITY, GRB_INFINITY, 0.0, GRB_CONTINUOUS);
+        model.addConstr(start >= 1);
+        model.addConstr(start + 2 - makespan <= 0);
+        model.addConstr(makespan >= 5);
+        model.set(GRB_IntAttr_ModelSense, GRB_MINIMIZE);
+        model.setObjectiveN(GRBLinExpr(makespan), 0, 1);
+        model.setObjectiveN(-GRBLinExpr(start), 1, 0);
+        model.optimize();
+
+        // The makespan is minimized first, then the start is pushed as late as possible
+        ASSERT_EQ(model.get(GRB_IntAttr_Status), GRB_OPTIMAL);
+        ASSERT_NEAR(makespan.get(GRB_DoubleAttr_X), 5.0, 1e-5);
+        ASSERT_NEAR(start.get(GRB_DoubleAttr_X), 3.0, 1e-5);
+        ASSERT_EQ(model.get(GRB_IntAttr_NumConstrs), 3);
+    }
+}  // namespace grstapse::unittests
+
+#endif
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <memory>
+// External
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/task_allocation/itags/incremental_task_allocation_node.hpp>
+#include <grstapse/task_allocation/itags/robot_traits_matrix_reduction.hpp>
+#include <grstapse/task_allocation/itags/task_allocation_math.hpp>
+// Mock
+#include "mock_itags_problem_inputs.hpp"
+
+namespace grstapse::unittests
+{
+    /*!
+     * The mismatch error carried down a branch matches the error of the whole allocation and is exactly zero once
+     * every task is satisfied
+     */
+    TEST(IncrementalTaskAllocationNode, TraitsMismatchError)
+    {
+        auto grstaps_problem_inputs        = std::make_shared<mocks::MockGrstapsProblemInputs>();
+        auto robot_traits_matrix_reduction = std::make_shared<RobotTraitsMatrixReduction>();
+        grstaps_problem_inputs->setRobotTraitsMatrixReduction(robot_traits_matrix_reduction);
+
+        // Traits that are not exactly representable
+        Eigen::MatrixXf team_traits_matrix(3, 2);
+        team_traits_matrix << 0.1f, 0.7f, 0.2f, 0.3f, 0.3f, 0.1f;
+        grstaps_problem_inputs->setTeamTraitsMatrix(team_traits_matrix);
+
+        auto problem_inputs = std::make_shared<mocks::MockItagsProblemInputs>(grstaps_problem_inputs);
+        Eigen::MatrixXf desired_traits_matrix(2, 2);
+        desired_traits_matrix << 0.5f, 1.0f, 0.55f, 0.9f;
+        problem_inputs->setDesiredTraitsMatrix(desired_traits_matrix);
+
+        auto node = std::make_shared<const IncrementalTaskAllocationNode>(MatrixDimensions{.height = 2, .width = 3});
+        for(const Assignment& assignment: {Assignment{.task = 0, .robot = 0},
+                                           Assignment{.task = 1, .robot = 2},
+                                           Assignment{.task = 0, .robot = 1},
+                                           Assignment{.task = 1, .robot = 1},
+                                           Assignment{.task = 0, .robot = 2}})
+        {
+            node = std::make_shared<const IncrementalTaskAllocationNode>(assignment, node);
+            const float expected = traitsMismatchError(*robot_traits_matrix_reduction,
+                                                       node->allocation(),
+                                                       desired_traits_matrix,
+                                                       team_traits_matrix);
+            ASSERT_NEAR(node->traitsMismatchError(*problem_inputs), expected, 1e-6f);
+            ASSERT_GT(node->traitsMismatchError(*problem_inputs), 0.0f);
+        }
+
+        // Satisfies the last unsatisfied task
+        node = std::make_shared<const IncrementalTaskAllocationNode>(Assignment{.task = 1, .robot = 0}, node);
+        ASSERT_EQ(node->traitsMismatchError(*problem_inputs), 0.0f);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
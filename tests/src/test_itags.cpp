@@ -92,6 +92,38 @@ namespace grstapse::unittests
         MilpSolverBase::clearEnvironments();
     }
 
+    /*!
+     * Test that deferring the schedule evaluation finds an allocation with the same makespan
+     */
+    TEST(Itags, LazyEvaluation)
+    {
+        {
+            std::ifstream fin(std::string(s_data_dir) + std::string("/problem_inputs/itags/full_run.json"));
+            nlohmann::json j;
+            fin >> j;
+            std::shared_ptr<const ItagsProblemInputs> eager_problem_inputs =
+                j.get<std::shared_ptr<ItagsProblemInputs>>();
+            j[constants::k_itags_parameters][constants::k_lazy_evaluation] = true;
+            std::shared_ptr<const ItagsProblemInputs> lazy_problem_inputs =
+                j.get<std::shared_ptr<ItagsProblemInputs>>();
+
+            Itags eager_itags(eager_problem_inputs);
+            SearchResults<IncrementalTaskAllocationNode, ItagsStatistics> eager_results = eager_itags.search();
+            ASSERT_TRUE(eager_results.foundGoal());
+
+            Itags lazy_itags(lazy_problem_inputs);
+            SearchResults<IncrementalTaskAllocationNode, ItagsStatistics> lazy_results = lazy_itags.search();
+            ASSERT_TRUE(lazy_results.foundGoal());
+            ASSERT_TRUE(lazy_results.goal()->schedule());
+            ASSERT_NEAR(lazy_results.goal()->schedule()->makespan(),
+                        eager_results.goal()->schedule()->makespan(),
+                        1e-3);
+            ASSERT_LE(lazy_results.statistics()->numberOfNodesEvaluated(),
+                      eager_results.statistics()->numberOfNodesEvaluated());
+        }
+        MilpSolverBase::clearEnvironments();
+    }
+
     /*!
      * TODO(Andrew,Glen): better tests
      */
@@ -0,0 +1,75 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <limits>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/scheduling/milp/deterministic/longest_path_evaluator.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(LongestPathEvaluator, Chain)
+    {
+        // 0 -> 2, 1 -> 2, 2 -> 3
+        LongestPathEvaluator evaluator(4);
+        evaluator.setTask(0, 1.0f, 2.0f);
+        evaluator.setTask(1, 4.0f, 1.0f);
+        evaluator.setTask(2, 0.0f, 3.0f);
+        evaluator.setTask(3, 0.0f, 1.0f);
+        evaluator.addEdge(0, 2, 1.0f);
+        evaluator.addEdge(1, 2, 0.5f);
+        evaluator.addEdge(2, 3, 2.0f);
+
+        // 1 starts at 4, finishes at 5, 2 starts at 5.5, finishes at 8.5, 3 starts at 10.5, finishes at 11.5
+        const LongestPathResult result = evaluator.evaluate();
+        ASSERT_FLOAT_EQ(result.makespan, 11.5f);
+        ASSERT_EQ(result.critical_chain, (std::vector<unsigned int>{1, 2, 3}));
+    }
+
+    TEST(LongestPathEvaluator, LowerBound)
+    {
+        // The lower bound of the last task dominates the path through its predecessor
+        LongestPathEvaluator evaluator(2);
+        evaluator.setTask(0, 0.0f, 1.0f);
+        evaluator.setTask(1, 10.0f, 1.0f);
+        evaluator.addEdge(0, 1, 1.0f);
+
+        const LongestPathResult result = evaluator.evaluate();
+        ASSERT_FLOAT_EQ(result.makespan, 11.0f);
+        ASSERT_EQ(result.critical_chain, (std::vector<unsigned int>{1}));
+    }
+
+    TEST(LongestPathEvaluator, Cycle)
+    {
+        LongestPathEvaluator evaluator(2);
+        evaluator.setTask(0, 0.0f, 1.0f);
+        evaluator.setTask(1, 0.0f, 1.0f);
+        evaluator.addEdge(0, 1, 0.0f);
+        evaluator.addEdge(1, 0, 0.0f);
+
+        const LongestPathResult result = evaluator.evaluate();
+        ASSERT_EQ(result.makespan, std::numeric_limits<float>::infinity());
+        ASSERT_TRUE(result.critical_chain.empty());
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef NO_MILP
+
+// External
+#    include <fmt/format.h>
+#    include <gtest/gtest.h>
+// Project
+#    include <grstapse/scheduling/common_scheduler_motion_planner_interface.hpp>
+#    include <grstapse/scheduling/makespan_lower_bound.hpp>
+// Local
+#    include "scheduling_setup.hpp"
+
+namespace grstapse::unittests
+{
+    /*!
+     * Test that the bound never exceeds the makespan found by the deterministic scheduler
+     */
+    TEST(MakespanLowerBound, BelowOptimalMakespan)
+    {
+        auto run_test = [](const std::string& identifier,
+                           const PlanOption plan_option,
+                           const AllocationOption allocation_option,
+                           const bool homogeneous,
+                           const float correct_makespan)
+        {
+            auto scheduler_problem_inputs = createSchedulerProblemInputs(plan_option, allocation_option, homogeneous);
+            const float bound =
+                computeMakespanLowerBound(*scheduler_problem_inputs, CommonSchedulerMotionPlannerInterface());
+            ASSERT_GT(bound, 0.0f) << fmt::format("{0:s}: Bound is not positive", identifier);
+            ASSERT_LE(bound, correct_makespan + 1e-3f)
+                << fmt::format("{0:s}: Bound exceeds the makespan (makespan: {1:f}; bound: {2:f})",
+                               identifier,
+                               correct_makespan,
+                               bound);
+        };
+
+        run_test("TO-I", PlanOption::e_total_order, AllocationOption::e_identity, true, 29.0f);
+        run_test("Branch-I", PlanOption::e_branch, AllocationOption::e_identity, true, 22.0f);
+        run_test("Branch-MR", PlanOption::e_branch, AllocationOption::e_multi_task_robot, true, 32.0f);
+    }
+
+    /*!
+     * Test that a robot performing multiple tasks tightens the bound
+     */
+    TEST(MakespanLowerBound, RobotSequencing)
+    {
+        auto identity = createSchedulerProblemInputs(PlanOption::e_branch, AllocationOption::e_identity, true);
+        auto multi_task_robot =
+            createSchedulerProblemInputs(PlanOption::e_branch, AllocationOption::e_multi_task_robot, true);
+        CommonSchedulerMotionPlannerInterface interface;
+        ASSERT_GT(computeMakespanLowerBound(*multi_task_robot, interface),
+                  computeMakespanLowerBound(*identity, interface));
+    }
+}  // namespace grstapse::unittests
+#endif
\ No newline at end of file
@@ -0,0 +1,160 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/common/utilities/metrics.hpp>
+#include <grstapse/common/utilities/time_keeper.hpp>
+#include <grstapse/common/utilities/timer_runner.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(Metrics, Intern)
+    {
+        const MetricId id = Metrics::intern("metrics_intern");
+        ASSERT_EQ(Metrics::intern("metrics_intern"), id);
+        ASSERT_EQ(Metrics::find("metrics_intern"), id);
+        ASSERT_EQ(Metrics::name(id), "metrics_intern");
+        ASSERT_FALSE(Metrics::find("metrics_never_interned").has_value());
+    }
+
+    TEST(Metrics, ThreadsMerged)
+    {
+        const MetricId id = Metrics::intern("metrics_threads");
+        Metrics metrics;
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back(
+                [&metrics, id]()
+                {
+                    for(unsigned int i = 0; i < 1000; ++i)
+                    {
+                        metrics.increment(id);
+                    }
+                });
+        }
+        for(std::thread& thread: threads)
+        {
+            thread.join();
+        }
+        ASSERT_EQ(metrics.value(id), 4000.0);
+        ASSERT_TRUE(metrics.contains(id));
+
+        metrics.remove(id);
+        ASSERT_EQ(metrics.value(id), 0.0);
+        ASSERT_FALSE(metrics.contains(id));
+    }
+
+    TEST(Metrics, ManyNames)
+    {
+        Metrics metrics;
+        std::vector<MetricId> ids;
+        for(unsigned int i = 0; i < 300; ++i)
+        {
+            ids.push_back(Metrics::intern("metrics_many_" + std::to_string(i)));
+            metrics.increment(ids.back(), static_cast<double>(i));
+        }
+        for(unsigned int i = 0; i < 300; ++i)
+        {
+            ASSERT_EQ(metrics.value(ids[i]), static_cast<double>(i));
+        }
+    }
+
+    TEST(Metrics, ConcurrentReset)
+    {
+        const MetricId id = Metrics::intern("metrics_concurrent_reset");
+        Metrics metrics;
+        std::atomic<bool> done = false;
+        std::thread resetter(
+            [&metrics, &done, id]()
+            {
+                while(!done)
+                {
+                    metrics.reset(id);
+                }
+            });
+        for(unsigned int i = 0; i < 100000; ++i)
+        {
+            metrics.increment(id);
+        }
+        done = true;
+        resetter.join();
+
+        // Increments after the last reset are kept
+        metrics.increment(id);
+        metrics.reset(id);
+        ASSERT_EQ(metrics.value(id), 0.0);
+        metrics.increment(id, 3.0);
+        ASSERT_EQ(metrics.value(id), 3.0);
+    }
+
+    TEST(Metrics, Scoped)
+    {
+        const MetricId id = Metrics::intern("metrics_scoped");
+        Metrics first;
+        Metrics second;
+        {
+            Metrics::Activation activation(first);
+            ASSERT_EQ(&Metrics::current(), &first);
+            Metrics::current().increment(id, 2.0);
+            {
+                Metrics::Activation nested(second);
+                Metrics::current().increment(id, 5.0);
+            }
+            ASSERT_EQ(&Metrics::current(), &first);
+        }
+        ASSERT_EQ(&Metrics::current(), &Metrics::global());
+        ASSERT_EQ(first.value(id), 2.0);
+        ASSERT_EQ(second.value(id), 5.0);
+        ASSERT_FALSE(Metrics::global().contains(id));
+    }
+
+    TEST(Metrics, Timers)
+    {
+        Metrics metrics;
+        Metrics::Activation activation(metrics);
+        {
+            TimerRunner outer("metrics_timer");
+            // Nested timers of the same name only count once
+            TimerRunner inner("metrics_timer");
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            // Running timers are included
+            ASSERT_GT(TimeKeeper::instance().time("metrics_timer"), 0.04f);
+            ASSERT_TRUE(metrics.hasRunningTimers());
+            ASSERT_THROW(metrics.resetAll(), std::logic_error);
+        }
+        ASSERT_FALSE(metrics.hasRunningTimers());
+        ASSERT_NEAR(TimeKeeper::instance().time("metrics_timer"), 0.05f, 1e-2f);
+
+        TimeKeeper::instance().reset("metrics_timer");
+        ASSERT_EQ(TimeKeeper::instance().time("metrics_timer"), 0.0f);
+        ASSERT_THROW((void)TimeKeeper::instance().time("metrics_unknown_timer"), std::logic_error);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,104 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <random>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/scheduling/mutex_set.hpp>
+#include <grstapse/scheduling/precedence_closure.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(MutexSet, FromAllocation)
+    {
+        Eigen::MatrixXf allocation(4, 2);
+        // clang-format off
+        allocation << 1, 0,
+                      1, 1,
+                      0, 1,
+                      0, 0;
+        // clang-format on
+        MutexSet mutex_set(allocation);
+        std::set<std::pair<unsigned int, unsigned int>> expected = {{0, 1}, {1, 2}};
+        ASSERT_EQ(mutex_set.constraints(), expected);
+        ASSERT_TRUE(mutex_set.contains(1, 0));
+        ASSERT_FALSE(mutex_set.contains(0, 2));
+        ASSERT_FALSE(mutex_set.contains(3, 3));
+    }
+
+    TEST(MutexSet, IncrementalMatchesRebuild)
+    {
+        // Enough tasks that rows span multiple words
+        const unsigned int num_tasks  = 150;
+        const unsigned int num_robots = 6;
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<unsigned int> task_distribution(0, num_tasks - 1);
+        std::uniform_int_distribution<unsigned int> robot_distribution(0, num_robots - 1);
+
+        Eigen::MatrixXf allocation = Eigen::MatrixXf::Zero(num_tasks, num_robots);
+        MutexSet mutex_set(num_tasks, num_robots);
+        for(unsigned int step = 0; step < 600; ++step)
+        {
+            const unsigned int task  = task_distribution(generator);
+            const unsigned int robot = robot_distribution(generator);
+            if(step % 3 == 2)
+            {
+                allocation(task, robot) = 0.0f;
+                mutex_set.remove(task, robot);
+            }
+            else
+            {
+                allocation(task, robot) = 1.0f;
+                mutex_set.add(task, robot);
+            }
+        }
+        ASSERT_EQ(mutex_set.constraints(), MutexSet(allocation).constraints());
+    }
+
+    TEST(MutexSet, RemoveKeepsSharedRobot)
+    {
+        MutexSet mutex_set(3, 2);
+        mutex_set.add(0, 0);
+        mutex_set.add(1, 0);
+        mutex_set.add(0, 1);
+        mutex_set.add(1, 1);
+        mutex_set.add(2, 0);
+        mutex_set.remove(0, 0);
+        // Robot 1 is still shared by tasks 0 and 1
+        ASSERT_TRUE(mutex_set.contains(0, 1));
+        ASSERT_FALSE(mutex_set.contains(0, 2));
+        ASSERT_TRUE(mutex_set.contains(1, 2));
+    }
+
+    TEST(MutexSet, UnorderedConstraints)
+    {
+        Eigen::MatrixXf allocation = Eigen::MatrixXf::Ones(4, 1);
+        MutexSet mutex_set(allocation);
+        PrecedenceClosure closure({{0, 1}, {1, 3}}, 4);
+        // (0, 1), (0, 3) and (1, 3) are ordered
+        std::vector<std::pair<unsigned int, unsigned int>> expected = {{0, 2}, {1, 2}, {2, 3}};
+        ASSERT_EQ(mutex_set.unorderedConstraints(closure), expected);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// External
+#include <Eigen/Core>
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/task_allocation/itags/packed_allocation.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(PackedAllocation, SetGet)
+    {
+        // More than one word per task
+        PackedAllocation allocation(MatrixDimensions{.height = 3, .width = 70});
+        ASSERT_TRUE(allocation.isZero());
+        ASSERT_EQ(allocation.wordsPerTask(), 2);
+
+        allocation.set(1, 65, true);
+        allocation.set(2, 3, true);
+        ASSERT_TRUE(allocation.get(1, 65));
+        ASSERT_TRUE(allocation.get(2, 3));
+        ASSERT_FALSE(allocation.get(1, 64));
+        ASSERT_EQ(allocation.numberOfAssignments(), 2);
+        ASSERT_EQ(allocation.numberOfRobots(1), 1);
+
+        allocation.set(1, 65, false);
+        ASSERT_FALSE(allocation.get(1, 65));
+        ASSERT_EQ(allocation.numberOfAssignments(), 1);
+    }
+
+    TEST(PackedAllocation, DenseRoundTrip)
+    {
+        // Allocation matrix is M X N (number_of_tasks X number_of_robots)
+        Eigen::MatrixXf matrix(2, 3);
+        matrix << 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f;
+
+        PackedAllocation allocation(matrix);
+        ASSERT_EQ(allocation.toMatrix(), matrix);
+        ASSERT_EQ(allocation, PackedAllocation(allocation.toMatrix()));
+        ASSERT_EQ(allocation.hash(), PackedAllocation(matrix).hash());
+
+        PackedAllocation ones(MatrixDimensions{.height = 2, .width = 3}, true);
+        ASSERT_EQ(ones.toMatrix(), Eigen::MatrixXf::Ones(2, 3));
+        ASSERT_NE(ones, allocation);
+    }
+
+    TEST(PackedAllocation, IncrementalKey)
+    {
+        PackedAllocation a(MatrixDimensions{.height = 4, .width = 5});
+        a.set(0, 1, true);
+        a.set(3, 4, true);
+        a.set(2, 2, true);
+        a.set(2, 2, false);
+
+        PackedAllocation b(MatrixDimensions{.height = 4, .width = 5});
+        b.set(3, 4, true);
+        b.set(0, 1, true);
+        // Setting an already set element does not change the key
+        b.set(0, 1, true);
+
+        ASSERT_EQ(a.key(), b.key());
+        ASSERT_EQ(a.key(), PackedAllocation(a.toMatrix()).key());
+        ASSERT_EQ(a.key(), PackedAllocation::zobristKey(0, 1) ^ PackedAllocation::zobristKey(3, 4));
+        ASSERT_NE(PackedAllocation::zobristKey(0, 1), PackedAllocation::zobristKey(1, 0));
+
+        ASSERT_EQ(a.verificationKey(), b.verificationKey());
+        ASSERT_EQ(a.verificationKey(),
+                  PackedAllocation::verificationZobristKey(0, 1) ^ PackedAllocation::verificationZobristKey(3, 4));
+        ASSERT_NE(PackedAllocation::zobristKey(0, 1), PackedAllocation::verificationZobristKey(0, 1));
+    }
+
+    TEST(PackedAllocation, CompareRobots)
+    {
+        PackedAllocation allocation(MatrixDimensions{.height = 3, .width = 3});
+        allocation.set(0, 1, true);
+        allocation.set(1, 0, true);
+        allocation.set(2, 0, true);
+
+        // The first task decides the order
+        ASSERT_EQ(allocation.compareRobots(1, 0), std::strong_ordering::greater);
+        ASSERT_EQ(allocation.compareRobots(0, 1), std::strong_ordering::less);
+        ASSERT_EQ(allocation.compareRobots(0, 2), std::strong_ordering::greater);
+        ASSERT_EQ(allocation.compareRobots(2, 2), std::strong_ordering::equal);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
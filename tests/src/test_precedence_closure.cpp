@@ -0,0 +1,63 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/scheduling/precedence_closure.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(PrecedenceClosure, Chain)
+    {
+        PrecedenceClosure closure({{0, 1}, {1, 2}, {2, 3}}, 5);
+        ASSERT_EQ(closure.numberOfTasks(), 5);
+        ASSERT_TRUE(closure.precedes(0, 3));
+        ASSERT_TRUE(closure.precedes(1, 3));
+        ASSERT_FALSE(closure.precedes(3, 0));
+        ASSERT_TRUE(closure.ordered(3, 0));
+        ASSERT_FALSE(closure.ordered(0, 4));
+        ASSERT_FALSE(closure.precedes(0, 7));
+        ASSERT_EQ(closure.constraints().size(), 6);
+    }
+
+    TEST(PrecedenceClosure, SpansWords)
+    {
+        // 0 -> 70 -> 130 crosses two word boundaries
+        PrecedenceClosure closure({{70, 130}, {0, 70}});
+        ASSERT_EQ(closure.numberOfTasks(), 131);
+        ASSERT_EQ(closure.wordsPerTask(), 3);
+        ASSERT_TRUE(closure.precedes(0, 130));
+        ASSERT_FALSE(closure.precedes(130, 0));
+        std::set<std::pair<unsigned int, unsigned int>> expected = {{0, 70}, {0, 130}, {70, 130}};
+        ASSERT_EQ(closure.constraints(), expected);
+    }
+
+    TEST(PrecedenceClosure, Cycle)
+    {
+        PrecedenceClosure closure({{0, 1}, {1, 0}});
+        ASSERT_TRUE(closure.precedes(0, 0));
+        ASSERT_TRUE(closure.precedes(1, 1));
+        ASSERT_EQ(closure.constraints().size(), 4);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
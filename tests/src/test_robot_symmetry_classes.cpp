@@ -0,0 +1,71 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/task_allocation/itags/robot_symmetry_classes.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(RobotSymmetryClasses, Classes)
+    {
+        RobotSymmetryClasses no_symmetry({0, 1, 2});
+        ASSERT_FALSE(no_symmetry.hasSymmetry());
+        ASSERT_EQ(no_symmetry.numberOfClasses(), 3);
+
+        RobotSymmetryClasses symmetry({0, 1, 0, 1, 0});
+        ASSERT_TRUE(symmetry.hasSymmetry());
+        ASSERT_EQ(symmetry.numberOfClasses(), 2);
+        ASSERT_EQ(symmetry.robotClass(2), 0);
+        ASSERT_EQ(symmetry.robotClass(3), 1);
+    }
+
+    TEST(RobotSymmetryClasses, Canonical)
+    {
+        // Robots 0 and 2 are interchangeable
+        RobotSymmetryClasses classes({0, 1, 0});
+
+        PackedAllocation allocation(MatrixDimensions{.height = 2, .width = 3});
+        ASSERT_TRUE(classes.isCanonical(allocation));
+
+        // Assigning the later robot first is a permutation of assigning the earlier one
+        allocation.set(1, 2, true);
+        ASSERT_FALSE(classes.isCanonical(allocation, 2));
+        ASSERT_FALSE(classes.isCanonical(allocation));
+        allocation.set(1, 2, false);
+
+        allocation.set(1, 0, true);
+        ASSERT_TRUE(classes.isCanonical(allocation, 0));
+        ASSERT_TRUE(classes.isCanonical(allocation));
+
+        // Robot 1 has no interchangeable robots
+        allocation.set(0, 1, true);
+        ASSERT_TRUE(classes.isCanonical(allocation, 1));
+
+        // Robot 2 on an earlier task than robot 0 is out of order
+        allocation.set(0, 2, true);
+        ASSERT_FALSE(classes.isCanonical(allocation, 2));
+        allocation.set(0, 0, true);
+        ASSERT_TRUE(classes.isCanonical(allocation));
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
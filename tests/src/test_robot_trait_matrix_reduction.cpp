@@ -487,4 +487,82 @@ namespace grstapse::unittests
         correct_result << 7.0f, 14.0f, 3.0f, 9.0f, 1.0f;  // [ [7 14 3 9 1]  ]
         ASSERT_EQ(result, correct_result);
     }
+
+    /*!
+     * Incremental update matches a full reduction for each reduction type when robots are added and removed
+     */
+    TEST(RobotTraitsMatrixReduction, IncrementalUpdate)
+    {
+        std::vector<std::vector<TraitsMatrixReductionTypes>> reduction_types = {
+            {TraitsMatrixReductionTypes::e_summation,
+             TraitsMatrixReductionTypes::e_product,
+             TraitsMatrixReductionTypes::e_minimum,
+             TraitsMatrixReductionTypes::e_maximum},
+            {TraitsMatrixReductionTypes::e_maximum,
+             TraitsMatrixReductionTypes::e_minimum,
+             TraitsMatrixReductionTypes::e_product,
+             TraitsMatrixReductionTypes::e_summation}};
+
+        RobotTraitsMatrixReduction reduction(reduction_types);
+        Eigen::MatrixXf robot_traits_matrix(3, 4);
+        robot_traits_matrix << 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 2.0f, 4.0f, 6.0f, 8.0f;
+
+        PackedAllocation allocation(MatrixDimensions{.height = 2, .width = 3});
+        allocation.set(0, 0, true);
+        allocation.set(1, 2, true);
+        Eigen::MatrixXf allocated_traits = reduction.reduce(allocation.toMatrix(), robot_traits_matrix);
+
+        // (assignment, whether the robot is added or removed)
+        const std::vector<std::pair<Assignment, bool>> changes = {{{.task = 0, .robot = 1}, true},
+                                                                  {{.task = 1, .robot = 0}, true},
+                                                                  {{.task = 0, .robot = 2}, true},
+                                                                  {{.task = 0, .robot = 0}, false},
+                                                                  {{.task = 1, .robot = 2}, false}};
+        for(const auto& [assignment, value]: changes)
+        {
+            allocation.set(assignment.task, assignment.robot, value);
+            reduction.update(allocated_traits, allocation, assignment, robot_traits_matrix);
+            ASSERT_EQ(allocated_traits, reduction.reduce(allocation.toMatrix(), robot_traits_matrix));
+        }
+    }
+
+    /*!
+     * Adding and then removing robots with traits that are not exactly representable leaves no residual error
+     */
+    TEST(RobotTraitsMatrixReduction, IncrementalUpdateNoDrift)
+    {
+        RobotTraitsMatrixReduction reduction;
+        const unsigned int num_robots       = 50;
+        Eigen::MatrixXf robot_traits_matrix = Eigen::MatrixXf::Constant(num_robots, 2, 0.1f);
+        robot_traits_matrix.col(1).setConstant(1.0f / 3.0f);
+
+        PackedAllocation allocation(MatrixDimensions{.height = 1, .width = num_robots});
+        Eigen::MatrixXf allocated_traits = Eigen::MatrixXf::Zero(1, 2);
+        for(unsigned int robot = 0; robot < num_robots; ++robot)
+        {
+            allocation.set(0, robot, true);
+            reduction.update(allocated_traits, allocation, {.task = 0, .robot = robot}, robot_traits_matrix);
+        }
+        const Eigen::MatrixXf full = allocated_traits;
+
+        // Remove in a different order than they were added, then add one robot back
+        for(unsigned int robot = 0; robot < num_robots; robot += 2)
+        {
+            allocation.set(0, robot, false);
+            reduction.update(allocated_traits, allocation, {.task = 0, .robot = robot}, robot_traits_matrix);
+        }
+        for(unsigned int robot = 1; robot < num_robots; robot += 2)
+        {
+            allocation.set(0, robot, false);
+            reduction.update(allocated_traits, allocation, {.task = 0, .robot = robot}, robot_traits_matrix);
+        }
+        ASSERT_EQ(allocated_traits, Eigen::MatrixXf::Zero(1, 2));
+
+        for(unsigned int robot = num_robots; robot-- > 0;)
+        {
+            allocation.set(0, robot, true);
+            reduction.update(allocated_traits, allocation, {.task = 0, .robot = robot}, robot_traits_matrix);
+        }
+        ASSERT_EQ(allocated_traits, full);
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <tuple>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/scheduling/milp/stochastic/scenario_reduction.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(ScenarioReduction, OnePerCluster)
+    {
+        // Three well separated clusters of sizes 3, 2, and 1
+        const std::vector<std::vector<float>> scenarios = {{0.0f, 0.0f},
+                                                           {10.0f, 10.0f},
+                                                           {0.5f, 0.0f},
+                                                           {100.0f, 0.0f},
+                                                           {0.0f, 0.5f},
+                                                           {10.5f, 10.0f}};
+        const std::vector<unsigned int> cluster = {0, 1, 0, 2, 0, 1};
+        const ReducedScenarios reduced          = reduceScenarios(scenarios, 3);
+        ASSERT_EQ(reduced.indices.size(), 3);
+        ASSERT_EQ(reduced.weights.size(), 3);
+        ASSERT_TRUE(std::is_sorted(reduced.indices.begin(), reduced.indices.end()));
+
+        // Each cluster is represented once and gets the probability of all of its scenarios
+        const std::vector<float> cluster_weights = {3.0f / 6.0f, 2.0f / 6.0f, 1.0f / 6.0f};
+        std::vector<bool> represented(3, false);
+        for(unsigned int k = 0; k < 3; ++k)
+        {
+            const unsigned int c = cluster[reduced.indices[k]];
+            ASSERT_FALSE(represented[c]);
+            represented[c] = true;
+            ASSERT_NEAR(reduced.weights[k], cluster_weights[c], 1e-5f);
+        }
+    }
+
+    TEST(ScenarioReduction, Required)
+    {
+        const std::vector<std::vector<float>> scenarios = {{0.0f}, {1.0f}, {2.0f}, {3.0f}, {4.0f}};
+        const std::array<unsigned int, 1> required      = {4};
+        const ReducedScenarios reduced                  = reduceScenarios(scenarios, 2, required);
+        ASSERT_EQ(reduced.indices.size(), 2);
+        ASSERT_EQ(reduced.indices.back(), 4);
+        ASSERT_NEAR(std::accumulate(reduced.weights.begin(), reduced.weights.end(), 0.0f), 1.0f, 1e-5f);
+    }
+
+    TEST(ScenarioReduction, SelectAll)
+    {
+        const std::vector<std::vector<float>> scenarios = {{1.0f}, {1.0f}, {2.0f}};
+        const ReducedScenarios reduced                  = reduceScenarios(scenarios, 3);
+        ASSERT_EQ(reduced.indices, (std::vector<unsigned int>{0, 1, 2}));
+        for(float weight: reduced.weights)
+        {
+            ASSERT_NEAR(weight, 1.0f / 3.0f, 1e-5f);
+        }
+    }
+
+    TEST(ScenarioReduction, Invalid)
+    {
+        const std::vector<std::vector<float>> scenarios = {{1.0f}, {2.0f}};
+        ASSERT_ANY_THROW(std::ignore = reduceScenarios(scenarios, 0));
+        ASSERT_ANY_THROW(std::ignore = reduceScenarios(scenarios, 3));
+        ASSERT_ANY_THROW(std::ignore = reduceScenarios({{1.0f}, {1.0f, 2.0f}}, 1));
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
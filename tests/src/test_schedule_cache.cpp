@@ -0,0 +1,153 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/common/utilities/timeout_failure.hpp>
+#include <grstapse/scheduling/schedule_base.hpp>
+#include <grstapse/scheduling/scheduler_result.hpp>
+#include <grstapse/task_allocation/itags/schedule_cache.hpp>
+
+namespace grstapse::unittests
+{
+    //! A schedule that only contains a makespan
+    class MakespanOnlySchedule : public ScheduleBase
+    {
+       public:
+        explicit MakespanOnlySchedule(float makespan)
+            : ScheduleBase(makespan, {})
+        {}
+
+        nlohmann::json serializeToJson(const std::shared_ptr<const SchedulerProblemInputs>&) const override
+        {
+            return nullptr;
+        }
+    };
+
+    PackedAllocation createAllocation(unsigned int task, unsigned int robot)
+    {
+        PackedAllocation allocation(MatrixDimensions{.height = 2, .width = 2});
+        allocation.set(task, robot, true);
+        return allocation;
+    }
+
+    std::shared_ptr<const SchedulerResult> createResult(float makespan)
+    {
+        return std::make_shared<const SchedulerResult>(std::make_shared<const MakespanOnlySchedule>(makespan));
+    }
+
+    TEST(ScheduleCache, FindAndEvict)
+    {
+        ScheduleCache cache(2, "test");
+        cache.insert(createAllocation(0, 0), createResult(1.0f));
+        cache.insert(createAllocation(0, 1), createResult(2.0f));
+
+        std::optional<ScheduleCache::Entry> entry = cache.find(createAllocation(0, 0));
+        ASSERT_TRUE(entry.has_value());
+        ASSERT_EQ(entry->makespan, 1.0f);
+        ASSERT_NE(entry->result, nullptr);
+
+        // (0, 1) is the least recently used and is evicted
+        cache.insert(createAllocation(1, 0), createResult(3.0f));
+        ASSERT_EQ(cache.size(), 2);
+        ASSERT_FALSE(cache.find(createAllocation(0, 1)).has_value());
+        ASSERT_TRUE(cache.find(createAllocation(1, 0)).has_value());
+        ASSERT_EQ(cache.numberOfHits(), 2);
+        ASSERT_EQ(cache.numberOfMisses(), 1);
+    }
+
+    TEST(ScheduleCache, Persist)
+    {
+        const std::filesystem::path filepath =
+            std::filesystem::temp_directory_path() / "grstapse_test_schedule_cache.json";
+        std::filesystem::remove(filepath);
+        {
+            ScheduleCache cache(4, "test", filepath);
+            cache.insert(createAllocation(0, 0), createResult(1.0f));
+            cache.insert(createAllocation(1, 1),
+                         std::make_shared<const SchedulerResult>(std::make_shared<const TimeoutFailure>()));
+            ASSERT_EQ(cache.size(), 2);
+        }
+
+        {
+            ScheduleCache same_configuration(4, "test", filepath);
+            std::optional<ScheduleCache::Entry> entry = same_configuration.find(createAllocation(0, 0));
+            ASSERT_TRUE(entry.has_value());
+            ASSERT_EQ(entry->makespan, 1.0f);
+            ASSERT_EQ(entry->result, nullptr);
+
+            // Failures are not persisted
+            ASSERT_FALSE(same_configuration.find(createAllocation(1, 1)).has_value());
+        }
+        {
+            ScheduleCache different_configuration(4, "other", filepath);
+            ASSERT_EQ(different_configuration.size(), 0);
+        }
+
+        std::filesystem::remove(filepath);
+    }
+
+    TEST(ScheduleCache, Malformed)
+    {
+        const std::filesystem::path filepath =
+            std::filesystem::temp_directory_path() / "grstapse_test_schedule_cache_malformed.json";
+
+        // Not json
+        {
+            std::ofstream fout(filepath);
+            fout << "{\"configuration\": \"test\", \"entries\": [";
+        }
+        {
+            ScheduleCache cache(4, "test", filepath);
+            ASSERT_EQ(cache.size(), 0);
+        }
+
+        // Missing field
+        {
+            std::ofstream fout(filepath);
+            fout << R"({"configuration": "test", "entries": []})";
+        }
+        {
+            ScheduleCache cache(4, "test", filepath);
+            ASSERT_EQ(cache.size(), 0);
+        }
+
+        // Assignment outside of the dimensions
+        {
+            std::ofstream fout(filepath);
+            fout << R"({"configuration": "test", "dimensions": [2, 2], "entries": [)"
+                 << R"({"allocation": [[0, 0]], "makespan": 1.0}, {"allocation": [[0, 2]], "makespan": 2.0}]})";
+        }
+        {
+            ScheduleCache cache(4, "test", filepath);
+            ASSERT_EQ(cache.size(), 0);
+        }
+
+        std::filesystem::remove(filepath);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
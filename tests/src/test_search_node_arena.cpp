@@ -0,0 +1,148 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/common/search/search_node_arena.hpp>
+#include <grstapse/task_allocation/itags/incremental_task_allocation_node.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(SearchNodeArena, Allocate)
+    {
+        SearchNodeArena arena(SearchNodeArena::k_max_pooled_size);
+        std::set<std::uintptr_t> addresses;
+        for(unsigned int i = 0; i < 100; ++i)
+        {
+            void* ptr = arena.allocate(24, 8);
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 8, 0);
+            ASSERT_TRUE(addresses.insert(reinterpret_cast<std::uintptr_t>(ptr)).second);
+        }
+        // 24 bytes are rounded up to 32, so a 1024 byte chunk holds 32 of them
+        ASSERT_EQ(arena.numberOfChunks(), 4);
+
+        // Oversized requests go to the global allocator
+        void* oversized = arena.allocate(2048, 16);
+        ASSERT_NE(oversized, nullptr);
+        ASSERT_EQ(arena.numberOfChunks(), 4);
+        arena.deallocate(oversized, 2048, 16);
+    }
+
+    TEST(SearchNodeArena, Reuse)
+    {
+        SearchNodeArena arena(SearchNodeArena::k_max_pooled_size);
+        void* first  = arena.allocate(24, 8);
+        void* second = arena.allocate(100, 8);
+        arena.deallocate(first, 24, 8);
+        arena.deallocate(second, 100, 8);
+
+        // Released memory is reused by the same size class only
+        ASSERT_EQ(arena.allocate(32, 8), first);
+        ASSERT_EQ(arena.allocate(112, 16), second);
+        ASSERT_NE(arena.allocate(24, 8), first);
+        ASSERT_EQ(arena.numberOfChunks(), 1);
+    }
+
+    TEST(SearchNodeArena, ReuseFromOtherThread)
+    {
+        SearchNodeArena arena(SearchNodeArena::k_max_pooled_size);
+        void* ptr = arena.allocate(24, 8);
+        std::thread([&arena, ptr]() { arena.deallocate(ptr, 24, 8); }).join();
+        ASSERT_EQ(arena.allocate(24, 8), ptr);
+    }
+
+    TEST(SearchNodeArena, ReuseNodes)
+    {
+        auto arena = std::make_shared<SearchNodeArena>();
+        auto root =
+            allocateSearchNode<IncrementalTaskAllocationNode>(*arena, MatrixDimensions{.height = 2, .width = 2}, false);
+        const void* address = nullptr;
+        {
+            auto child =
+                allocateSearchNode<IncrementalTaskAllocationNode>(*arena, Assignment{.task = 1, .robot = 0}, root);
+            address = child.get();
+        }
+        auto child = allocateSearchNode<IncrementalTaskAllocationNode>(*arena, Assignment{.task = 0, .robot = 1}, root);
+        ASSERT_EQ(child.get(), address);
+        ASSERT_EQ(arena->numberOfChunks(), 1);
+    }
+
+    TEST(SearchNodeArena, Nodes)
+    {
+        std::shared_ptr<IncrementalTaskAllocationNode> child;
+        {
+            auto arena = std::make_shared<SearchNodeArena>();
+            auto root  = allocateSearchNode<IncrementalTaskAllocationNode>(
+                *arena,
+                MatrixDimensions{.height = 2, .width = 2},
+                false,
+                arena.get());
+            child = allocateSearchNode<IncrementalTaskAllocationNode>(*arena, Assignment{.task = 1, .robot = 0}, root);
+
+            // Identifiers are per arena
+            ASSERT_EQ(root->id(), 0);
+            ASSERT_EQ(child->id(), 1);
+            ASSERT_EQ(child->arena(), arena.get());
+        }
+
+        // The nodes keep the arena alive after the search (and its reference) are gone
+        ASSERT_TRUE(child->packedAllocation().get(1, 0));
+        ASSERT_EQ(child->arena()->numberOfIds(), 2);
+        ASSERT_EQ(child->parent()->id(), 0);
+    }
+
+    TEST(SearchNodeArena, ConcurrentIds)
+    {
+        SearchNodeArena arena;
+        std::vector<std::vector<unsigned int>> ids(4);
+        std::vector<std::thread> threads;
+        for(std::vector<unsigned int>& thread_ids: ids)
+        {
+            threads.emplace_back(
+                [&arena, &thread_ids]()
+                {
+                    for(unsigned int i = 0; i < 1000; ++i)
+                    {
+                        thread_ids.push_back(arena.nextId());
+                    }
+                });
+        }
+        for(std::thread& thread: threads)
+        {
+            thread.join();
+        }
+
+        std::set<unsigned int> unique;
+        for(const std::vector<unsigned int>& thread_ids: ids)
+        {
+            unique.insert(thread_ids.begin(), thread_ids.end());
+        }
+        ASSERT_EQ(unique.size(), 4000);
+        ASSERT_EQ(*unique.rbegin(), 3999);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
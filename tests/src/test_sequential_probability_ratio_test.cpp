@@ -0,0 +1,73 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <random>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/scheduling/milp/stochastic/heuristic_approximation/sequential_probability_ratio_test.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(SequentialProbabilityRatioTest, MinimumAcceptedReference)
+    {
+        std::mt19937 generator(3);
+        std::normal_distribution<float> distribution(100.0f, 10.0f);
+        std::vector<float> samples(500);
+        for(float& sample: samples)
+        {
+            sample = distribution(generator);
+        }
+
+        SequentialProbabilityRatioTest sprt(0.05f, 0.15f);
+        std::optional<float> reference = sprt.minimumAcceptedReference(80.0f, samples);
+        ASSERT_TRUE(reference.has_value());
+        ASSERT_TRUE(sprt.run(*reference, samples));
+
+        // No smaller sample value is accepted
+        for(const float sample: samples)
+        {
+            if(sample >= 80.0f && sample < *reference)
+            {
+                ASSERT_FALSE(sprt.run(sample, samples));
+            }
+        }
+        ASSERT_FALSE(sprt.run(80.0f, samples));
+    }
+
+    TEST(SequentialProbabilityRatioTest, LowerBoundAccepted)
+    {
+        std::vector<float> samples(200, 10.0f);
+        SequentialProbabilityRatioTest sprt(0.05f, 0.15f);
+        ASSERT_EQ(sprt.minimumAcceptedReference(20.0f, samples), 20.0f);
+    }
+
+    TEST(SequentialProbabilityRatioTest, NothingAccepted)
+    {
+        // Too few samples for the test to ever accept
+        std::vector<float> samples(2, 10.0f);
+        SequentialProbabilityRatioTest sprt(0.05f, 0.15f);
+        ASSERT_FALSE(sprt.minimumAcceptedReference(0.0f, samples).has_value());
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file